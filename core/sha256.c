@@ -1,7 +1,28 @@
 #include <stdint.h>
 #include <string.h>
 
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define SHA256_X86
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
 void calc_sha_256(uint8_t hash[32], const void *input, size_t len);
+void calc_sha_256_many(uint8_t * hashes, const uint8_t * const * inputs, const size_t * lens, size_t n);
+int sha_256_select(int impl);
+
+/* The state of an incremental hash: the hash values, the number of bytes hashed so far, and the
+ * bytes of the chunk that is not yet complete. */
+struct sha_256_state {
+	uint32_t h[8];
+	uint64_t total_len;
+	uint8_t chunk[64];
+};
+
+int sha_256_state_size(void);
+void sha_256_init(struct sha_256_state * state);
+void sha_256_update(struct sha_256_state * state, const void * input, size_t len);
+void sha_256_final(struct sha_256_state * state, uint8_t hash[32]);
 
 #define CHUNK_SIZE 64
 #define TOTAL_LEN_LEN 8
@@ -30,14 +51,6 @@ static const uint32_t k[] = {
 	0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
 };
 
-struct buffer_state {
-	const uint8_t * p;
-	size_t len;
-	size_t total_len;
-	int single_one_delivered; /* bool */
-	int total_len_delivered; /* bool */
-};
-
 static inline uint32_t right_rot(uint32_t value, unsigned int count)
 {
 	/*
@@ -47,81 +60,33 @@ static inline uint32_t right_rot(uint32_t value, unsigned int count)
 	return value >> count | value << (32 - count);
 }
 
-static void init_buf_state(struct buffer_state * state, const void * input, size_t len)
-{
-	state->p = input;
-	state->len = len;
-	state->total_len = len;
-	state->single_one_delivered = 0;
-	state->total_len_delivered = 0;
-}
-
-/* Return value: bool */
-static int calc_chunk(uint8_t chunk[CHUNK_SIZE], struct buffer_state * state)
+/*
+ * Writes the padding of a message of len bytes, whose last len % 64 bytes are tail,
+ * into blocks as the final one or two chunks of the message. Returns the number of chunks.
+ */
+static size_t pad_message(uint8_t blocks[2 * CHUNK_SIZE], const uint8_t * tail, uint64_t len)
 {
-	size_t space_in_chunk;
-
-	if (state->total_len_delivered) {
-		return 0;
-	}
+	const size_t rest = (size_t) (len % CHUNK_SIZE);
+	const size_t n = rest + 1 + TOTAL_LEN_LEN <= CHUNK_SIZE ? 1 : 2;
+	uint64_t bits = (uint64_t) len << 3;
+	int i;
 
-	if (state->len >= CHUNK_SIZE) {
-		memcpy(chunk, state->p, CHUNK_SIZE);
-		state->p += CHUNK_SIZE;
-		state->len -= CHUNK_SIZE;
-		return 1;
-	}
+	memcpy(blocks, tail, rest);
+	blocks[rest] = 0x80;
+	memset(blocks + rest + 1, 0x00, n * CHUNK_SIZE - rest - 1 - TOTAL_LEN_LEN);
 
-	memcpy(chunk, state->p, state->len);
-	chunk += state->len;
-	space_in_chunk = CHUNK_SIZE - state->len;
-	state->p += state->len;
-	state->len = 0;
-
-	/* If we are here, space_in_chunk is one at minimum. */
-	if (!state->single_one_delivered) {
-		*chunk++ = 0x80;
-		space_in_chunk -= 1;
-		state->single_one_delivered = 1;
-	}
-
-	/*
-	 * Now:
-	 * - either there is enough space left for the total length, and we can conclude,
-	 * - or there is too little space left, and we have to pad the rest of this chunk with zeroes.
-	 * In the latter case, we will conclude at the next invokation of this function.
-	 */
-	if (space_in_chunk >= TOTAL_LEN_LEN) {
-		const size_t left = space_in_chunk - TOTAL_LEN_LEN;
-		size_t len = state->total_len;
-		int i;
-		memset(chunk, 0x00, left);
-		chunk += left;
-
-		/* Storing of len * 8 as a big endian 64-bit without overflow. */
-		chunk[7] = (uint8_t) (len << 3);
-		len >>= 5;
-		for (i = 6; i >= 0; i--) {
-			chunk[i] = (uint8_t) len;
-			len >>= 8;
-		}
-		state->total_len_delivered = 1;
-	} else {
-		memset(chunk, 0x00, space_in_chunk);
+	/* Storing of len * 8 as a big endian 64-bit. */
+	for (i = 1; i <= TOTAL_LEN_LEN; i++) {
+		blocks[n * CHUNK_SIZE - i] = (uint8_t) bits;
+		bits >>= 8;
 	}
-
-	return 1;
+	return n;
 }
 
 /*
- * Limitations:
- * - Since input is a pointer in RAM, the data to hash should be in RAM, which could be a problem
- *   for large data sizes.
- * - SHA algorithms theoretically operate on bit strings. However, this implementation has no support
- *   for bit string lengths that are not multiples of eight, and it really operates on arrays of bytes.
- *   In particular, the len parameter is a number of bytes.
+ * Portable compression function. Processes n 512-bit chunks at p, updating the hash values h.
  */
-void calc_sha_256(uint8_t hash[32], const void * input, size_t len)
+static void calc_chunks_scalar(uint32_t h[8], const uint8_t * p, size_t n)
 {
 	/*
 	 * Note 1: All integers (expect indexes) are 32-bit unsigned integers and addition is calculated modulo 2^32.
@@ -131,26 +96,11 @@ void calc_sha_256(uint8_t hash[32], const void * input, size_t len)
 	 *     and when parsing message block data from bytes to words, for example,
 	 *     the first word of the input message "abc" after padding is 0x61626380
 	 */
-
-	/*
-	 * Initialize hash values:
-	 * (first 32 bits of the fractional parts of the square roots of the first 8 primes 2..19):
-	 */
-	uint32_t h[] = { 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 };
 	unsigned i, j;
 
-	/* 512-bit chunks is what we will operate on. */
-	uint8_t chunk[64];
-
-	struct buffer_state state;
-
-	init_buf_state(&state, input, len);
-
-	while (calc_chunk(chunk, &state)) {
+	for (; n > 0; n--) {
 		uint32_t ah[8];
 
-		const uint8_t *p = chunk;
-
 		/* Initialize working variables to current hash value: */
 		for (i = 0; i < 8; i++)
 			ah[i] = h[i];
@@ -207,6 +157,232 @@ void calc_sha_256(uint8_t hash[32], const void * input, size_t len)
 		for (i = 0; i < 8; i++)
 			h[i] += ah[i];
 	}
+}
+
+#ifdef SHA256_X86
+
+/*
+ * Compression function using the SHA extensions. The hash values are held as the
+ * ABEF and CDGH halves that the sha256rnds2 instruction expects, and each group of
+ * four rounds extends the message schedule by four words with sha256msg1 and sha256msg2.
+ */
+__attribute__((target("sha,sse4.1")))
+static void calc_chunks_shani(uint32_t h[8], const uint8_t * p, size_t n)
+{
+	const __m128i byte_swap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+	__m128i state0, state1, tmp;
+	unsigned i;
+
+	tmp = _mm_loadu_si128((const __m128i *) &h[0]);
+	state1 = _mm_loadu_si128((const __m128i *) &h[4]);
+	tmp = _mm_shuffle_epi32(tmp, 0xB1);            /* CDAB */
+	state1 = _mm_shuffle_epi32(state1, 0x1B);      /* EFGH */
+	state0 = _mm_alignr_epi8(tmp, state1, 8);      /* ABEF */
+	state1 = _mm_blend_epi16(state1, tmp, 0xF0);   /* CDGH */
+
+	for (; n > 0; n--, p += CHUNK_SIZE) {
+		const __m128i abef = state0;
+		const __m128i cdgh = state1;
+		/* w[i] holds the four words of the message schedule used by rounds 4i .. 4i + 3, modulo 4. */
+		__m128i w[4];
+
+		for (i = 0; i < 16; i++) {
+			__m128i msg;
+			if (i < 4) {
+				w[i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) (p + 16 * i)), byte_swap);
+			} else {
+				msg = _mm_sha256msg1_epu32(w[i & 3], w[(i + 1) & 3]);
+				msg = _mm_add_epi32(msg, _mm_alignr_epi8(w[(i + 3) & 3], w[(i + 2) & 3], 4));
+				w[i & 3] = _mm_sha256msg2_epu32(msg, w[(i + 3) & 3]);
+			}
+			msg = _mm_add_epi32(w[i & 3], _mm_loadu_si128((const __m128i *) &k[4 * i]));
+			state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+			msg = _mm_shuffle_epi32(msg, 0x0E);
+			state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+		}
+
+		state0 = _mm_add_epi32(state0, abef);
+		state1 = _mm_add_epi32(state1, cdgh);
+	}
+
+	tmp = _mm_shuffle_epi32(state0, 0x1B);         /* FEBA */
+	state1 = _mm_shuffle_epi32(state1, 0xB1);      /* DCHG */
+	state0 = _mm_blend_epi16(tmp, state1, 0xF0);   /* DCBA */
+	state1 = _mm_alignr_epi8(state1, tmp, 8);      /* HGFE */
+	_mm_storeu_si128((__m128i *) &h[0], state0);
+	_mm_storeu_si128((__m128i *) &h[4], state1);
+}
+
+/*
+ * Compression function for eight messages at once, one in each 32-bit lane of the
+ * AVX2 registers. Processes one chunk from each of p[0 .. 7], updating the hash values
+ * h[0 .. 7] of the eight messages.
+ */
+#define ROTR8(x, n) _mm256_or_si256(_mm256_srli_epi32(x, n), _mm256_slli_epi32(x, 32 - (n)))
+
+__attribute__((target("avx2")))
+static void calc_chunks_avx2_x8(uint32_t h[8][8], const uint8_t * const p[8])
+{
+	const __m256i byte_swap = _mm256_set_epi8(
+		12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3,
+		12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+	uint32_t lanes[8];
+	__m256i w[16], ah[8], h0[8];
+	unsigned i, j;
+
+	/* Transpose the hash values, and the message words, so that each register holds one word of every message. */
+	for (i = 0; i < 8; i++) {
+		h0[i] = _mm256_set_epi32(h[7][i], h[6][i], h[5][i], h[4][i], h[3][i], h[2][i], h[1][i], h[0][i]);
+		ah[i] = h0[i];
+	}
+	for (i = 0; i < 2; i++) {
+		__m256i r[8], t[8], u[8];
+		for (j = 0; j < 8; j++)
+			r[j] = _mm256_loadu_si256((const __m256i *) (p[j] + 32 * i));
+		for (j = 0; j < 8; j += 2) {
+			t[j] = _mm256_unpacklo_epi32(r[j], r[j + 1]);
+			t[j + 1] = _mm256_unpackhi_epi32(r[j], r[j + 1]);
+		}
+		for (j = 0; j < 8; j += 4) {
+			u[j] = _mm256_unpacklo_epi64(t[j], t[j + 2]);
+			u[j + 1] = _mm256_unpackhi_epi64(t[j], t[j + 2]);
+			u[j + 2] = _mm256_unpacklo_epi64(t[j + 1], t[j + 3]);
+			u[j + 3] = _mm256_unpackhi_epi64(t[j + 1], t[j + 3]);
+		}
+		for (j = 0; j < 4; j++) {
+			w[8 * i + j] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(u[j], u[j + 4], 0x20), byte_swap);
+			w[8 * i + j + 4] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(u[j], u[j + 4], 0x31), byte_swap);
+		}
+	}
+
+	for (i = 0; i < 64; i++) {
+		__m256i s0, s1, ch, maj, temp1, temp2;
+		if (i >= 16) {
+			const __m256i w1 = w[(i + 1) & 0xf];
+			const __m256i w14 = w[(i + 14) & 0xf];
+			s0 = _mm256_xor_si256(_mm256_xor_si256(ROTR8(w1, 7), ROTR8(w1, 18)), _mm256_srli_epi32(w1, 3));
+			s1 = _mm256_xor_si256(_mm256_xor_si256(ROTR8(w14, 17), ROTR8(w14, 19)), _mm256_srli_epi32(w14, 10));
+			w[i & 0xf] = _mm256_add_epi32(_mm256_add_epi32(w[i & 0xf], s0), _mm256_add_epi32(w[(i + 9) & 0xf], s1));
+		}
+		s1 = _mm256_xor_si256(_mm256_xor_si256(ROTR8(ah[4], 6), ROTR8(ah[4], 11)), ROTR8(ah[4], 25));
+		ch = _mm256_xor_si256(_mm256_and_si256(ah[4], ah[5]), _mm256_andnot_si256(ah[4], ah[6]));
+		temp1 = _mm256_add_epi32(_mm256_add_epi32(ah[7], s1), _mm256_add_epi32(ch, w[i & 0xf]));
+		temp1 = _mm256_add_epi32(temp1, _mm256_set1_epi32((int) k[i]));
+		s0 = _mm256_xor_si256(_mm256_xor_si256(ROTR8(ah[0], 2), ROTR8(ah[0], 13)), ROTR8(ah[0], 22));
+		maj = _mm256_xor_si256(_mm256_and_si256(ah[0], ah[1]),
+			_mm256_and_si256(ah[2], _mm256_xor_si256(ah[0], ah[1])));
+		temp2 = _mm256_add_epi32(s0, maj);
+
+		ah[7] = ah[6];
+		ah[6] = ah[5];
+		ah[5] = ah[4];
+		ah[4] = _mm256_add_epi32(ah[3], temp1);
+		ah[3] = ah[2];
+		ah[2] = ah[1];
+		ah[1] = ah[0];
+		ah[0] = _mm256_add_epi32(temp1, temp2);
+	}
+
+	for (i = 0; i < 8; i++) {
+		_mm256_storeu_si256((__m256i *) lanes, _mm256_add_epi32(h0[i], ah[i]));
+		for (j = 0; j < 8; j++)
+			h[j][i] = lanes[j];
+	}
+}
+
+#undef ROTR8
+
+#endif
+
+/*
+ * The implementation in use, chosen by sha_256_select. The SHA extensions are used
+ * for single messages when available, and AVX2 otherwise only pays off for eight
+ * messages at once.
+ */
+#define SHA256_AUTO -1
+#define SHA256_SCALAR 0
+#define SHA256_AVX2 1
+#define SHA256_SHANI 2
+
+static int implementation = SHA256_AUTO;
+
+static int supported(int impl)
+{
+#ifdef SHA256_X86
+	unsigned int a, b, c, d, lo, hi;
+	if (impl == SHA256_SCALAR)
+		return 1;
+	if (!__get_cpuid(1, &a, &b, &c, &d))
+		return 0;
+	const unsigned int leaf1_ecx = c;
+	if (__get_cpuid_max(0, 0) < 7)
+		return 0;
+	__cpuid_count(7, 0, a, b, c, d);
+	if (impl == SHA256_SHANI)
+		/* SHA, SSSE3 and SSE4.1 */
+		return (b >> 29 & 1) && (leaf1_ecx >> 9 & 1) && (leaf1_ecx >> 19 & 1);
+	if (impl == SHA256_AVX2) {
+		/* AVX2, and the OS saving the YMM registers, as reported by OSXSAVE and XGETBV */
+		if (!(b >> 5 & 1) || !(leaf1_ecx >> 27 & 1) || !(leaf1_ecx >> 28 & 1))
+			return 0;
+		__asm__ ("xgetbv" : "=a" (lo), "=d" (hi) : "c" (0));
+		return (lo & 6) == 6;
+	}
+	return 0;
+#else
+	return impl == SHA256_SCALAR;
+#endif
+}
+
+/*
+ * Selects the implementation used from now on. SHA256_AUTO selects the fastest that the
+ * CPU supports. Returns 0, leaving the selection unchanged, if the CPU does not support impl.
+ */
+int sha_256_select(int impl)
+{
+	if (impl == SHA256_AUTO) {
+		implementation = supported(SHA256_SHANI) ? SHA256_SHANI
+			: supported(SHA256_AVX2) ? SHA256_AVX2
+			: SHA256_SCALAR;
+		return 1;
+	}
+	if (!supported(impl))
+		return 0;
+	implementation = impl;
+	return 1;
+}
+
+static int selected_implementation(void)
+{
+	if (implementation == SHA256_AUTO)
+		sha_256_select(SHA256_AUTO);
+	return implementation;
+}
+
+static void calc_chunks(uint32_t h[8], const uint8_t * p, size_t n)
+{
+#ifdef SHA256_X86
+	if (selected_implementation() == SHA256_SHANI) {
+		calc_chunks_shani(h, p, n);
+		return;
+	}
+#endif
+	calc_chunks_scalar(h, p, n);
+}
+
+static void init_hash(uint32_t h[8])
+{
+	/*
+	 * Initialize hash values:
+	 * (first 32 bits of the fractional parts of the square roots of the first 8 primes 2..19):
+	 */
+	static const uint32_t h0[] = { 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 };
+	memcpy(h, h0, sizeof(h0));
+}
+
+static void write_hash(uint8_t hash[32], const uint32_t h[8])
+{
+	unsigned i, j;
 
 	/* Produce the final hash value (big-endian): */
 	for (i = 0, j = 0; i < 8; i++)
@@ -217,3 +393,187 @@ void calc_sha_256(uint8_t hash[32], const void * input, size_t len)
 		hash[j++] = (uint8_t) h[i];
 	}
 }
+
+/*
+ * Limitations:
+ * - Since input is a pointer in RAM, the data to hash should be in RAM, which could be a problem
+ *   for large data sizes.
+ * - SHA algorithms theoretically operate on bit strings. However, this implementation has no support
+ *   for bit string lengths that are not multiples of eight, and it really operates on arrays of bytes.
+ *   In particular, the len parameter is a number of bytes.
+ */
+void calc_sha_256(uint8_t hash[32], const void * input, size_t len)
+{
+	uint32_t h[8];
+	uint8_t last[2 * CHUNK_SIZE];
+	const uint8_t * p = input;
+	const size_t full = len / CHUNK_SIZE;
+
+	/* Whole chunks are hashed in place, and only the padded end of the message is copied. */
+	init_hash(h);
+	calc_chunks(h, p, full);
+	calc_chunks(h, last, pad_message(last, p + full * CHUNK_SIZE, len));
+	write_hash(hash, h);
+}
+
+#ifdef SHA256_X86
+
+/* Once fewer lanes than this are busy and no messages are waiting, the rest are finished one at a time. */
+#define MIN_LANES 2
+
+/* A message being hashed in one lane of calc_chunks_avx2_x8. */
+struct lane {
+	size_t message;
+	const uint8_t * p;
+	size_t chunks;
+	uint8_t last[2 * CHUNK_SIZE];
+	const uint8_t * last_p;
+	size_t last_chunks;
+	int active; /* bool */
+};
+
+static void start_lane(struct lane * l, uint32_t h[8], size_t message, const uint8_t * input, size_t len)
+{
+	const size_t full = len / CHUNK_SIZE;
+	l->message = message;
+	l->p = input;
+	l->chunks = full;
+	l->last_p = l->last;
+	l->last_chunks = pad_message(l->last, input + full * CHUNK_SIZE, len);
+	l->active = 1;
+	init_hash(h);
+}
+
+/* Returns the next chunk of the message, from the input while it has whole chunks left, and then from its padded end. */
+static const uint8_t * next_chunk(struct lane * l)
+{
+	const uint8_t * chunk;
+	if (l->chunks > 0) {
+		chunk = l->p;
+		l->p += CHUNK_SIZE;
+		l->chunks--;
+	} else {
+		chunk = l->last_p;
+		l->last_p += CHUNK_SIZE;
+		l->last_chunks--;
+	}
+	return chunk;
+}
+
+static void calc_sha_256_avx2(uint8_t * hashes, const uint8_t * const * inputs, const size_t * lens, size_t n)
+{
+	static const uint8_t idle[CHUNK_SIZE];
+	struct lane lanes[8];
+	uint32_t h[8][8];
+	const uint8_t * p[8];
+	size_t next = 0;
+	unsigned i, active;
+
+	for (i = 0; i < 8; i++)
+		lanes[i].active = 0;
+
+	for (;;) {
+		/* Retire the lanes whose messages are done, and start the waiting messages in the free lanes. */
+		active = 0;
+		for (i = 0; i < 8; i++) {
+			struct lane * l = &lanes[i];
+			if (l->active && l->chunks + l->last_chunks == 0) {
+				write_hash(hashes + 32 * l->message, h[i]);
+				l->active = 0;
+			}
+			if (!l->active && next < n) {
+				start_lane(l, h[i], next, inputs[next], lens[next]);
+				next++;
+			}
+			active += l->active;
+		}
+		if (active == 0)
+			return;
+
+		if (next == n && active < MIN_LANES) {
+			for (i = 0; i < 8; i++) {
+				struct lane * l = &lanes[i];
+				if (l->active) {
+					calc_chunks(h[i], l->p, l->chunks);
+					calc_chunks(h[i], l->last_p, l->last_chunks);
+					write_hash(hashes + 32 * l->message, h[i]);
+				}
+			}
+			return;
+		}
+
+		/* Idle lanes hash a chunk of zeroes, whose result is discarded. */
+		for (i = 0; i < 8; i++)
+			p[i] = lanes[i].active ? next_chunk(&lanes[i]) : idle;
+		calc_chunks_avx2_x8(h, p);
+	}
+}
+
+#endif
+
+/*
+ * Hashes n messages, writing the hash of inputs[i], of lens[i] bytes, to hashes[32 * i].
+ *
+ * With AVX2 selected, eight messages are hashed at once, one in each lane. A lane takes
+ * the next message as soon as it finishes the last, and the messages that are left when
+ * too few remain to fill the lanes are finished one at a time.
+ */
+void calc_sha_256_many(uint8_t * hashes, const uint8_t * const * inputs, const size_t * lens, size_t n)
+{
+	size_t i;
+#ifdef SHA256_X86
+	if (selected_implementation() == SHA256_AVX2) {
+		calc_sha_256_avx2(hashes, inputs, lens, n);
+		return;
+	}
+#endif
+	for (i = 0; i < n; i++)
+		calc_sha_256(hashes + 32 * i, inputs[i], lens[i]);
+}
+
+/*
+ * Incremental hashing. The input is given to sha_256_update in pieces of any length, and
+ * sha_256_final pads the message and writes its hash. Whole chunks of each piece are hashed
+ * in place, and only the bytes of a chunk that spans two pieces are gathered in the state.
+ */
+int sha_256_state_size(void)
+{
+	return (int) sizeof(struct sha_256_state);
+}
+
+void sha_256_init(struct sha_256_state * state)
+{
+	init_hash(state->h);
+	state->total_len = 0;
+}
+
+void sha_256_update(struct sha_256_state * state, const void * input, size_t len)
+{
+	const uint8_t * p = input;
+	const size_t used = state->total_len % CHUNK_SIZE;
+	size_t full;
+
+	state->total_len += len;
+
+	/* Complete the chunk left over from the previous pieces. */
+	if (used > 0) {
+		const size_t n = CHUNK_SIZE - used < len ? CHUNK_SIZE - used : len;
+		memcpy(state->chunk + used, p, n);
+		p += n;
+		len -= n;
+		if (used + n < CHUNK_SIZE)
+			return;
+		calc_chunks(state->h, state->chunk, 1);
+	}
+
+	full = len / CHUNK_SIZE;
+	calc_chunks(state->h, p, full);
+	memcpy(state->chunk, p + full * CHUNK_SIZE, len % CHUNK_SIZE);
+}
+
+void sha_256_final(struct sha_256_state * state, uint8_t hash[32])
+{
+	uint8_t last[2 * CHUNK_SIZE];
+	calc_chunks(state->h, last, pad_message(last, state->chunk, state->total_len));
+	write_hash(hash, state->h);
+}
@@ -2,6 +2,16 @@
   #include<Windows.h>
 #else
   #include<sys/wait.h>
+  #include<spawn.h>
+  #include<poll.h>
+  #include<sys/uio.h>
+  #include<sys/file.h>
+#endif
+#ifdef PLATFORM_LINUX
+  #include<sys/syscall.h>
+#endif
+#ifdef PLATFORM_OS_X
+  #include<mach-o/dyld.h>
 #endif
 #include<stdint.h>
 #include<unistd.h>
@@ -12,11 +22,15 @@
 #include<fcntl.h>
 #include<signal.h>
 #include<string.h>
+#include<math.h>
 #include<sys/stat.h>
 #include<sys/types.h>
 #include<sys/mman.h>
 #include<dirent.h>
 #include<pthread.h>
+#if defined(__SSE2__)
+  #include<emmintrin.h>
+#endif
 
 //       Forward Declarations
 //       ====================
@@ -203,6 +217,41 @@ int64_t file_write_block (FILE* f, char* data, int64_t len) {
   }
 #endif
 
+//     Executable Path
+//     ===============
+
+//Returns the path of the running executable, allocated with
+//stz_malloc, or 0 if it cannot be determined.
+char* executable_path (void){
+#if defined(PLATFORM_WINDOWS)
+  char* path = (char*)stz_malloc(2048);
+  DWORD n = GetModuleFileName(NULL, path, 2048);
+  if(n == 0 || n >= 2048){
+    stz_free(path);
+    return 0;
+  }
+  return path;
+#elif defined(PLATFORM_OS_X)
+  uint32_t size = 0;
+  _NSGetExecutablePath(NULL, &size);
+  char* path = (char*)stz_malloc(size + 1);
+  if(_NSGetExecutablePath(path, &size) != 0){
+    stz_free(path);
+    return 0;
+  }
+  return path;
+#else
+  char* path = (char*)stz_malloc(4096);
+  ssize_t n = readlink("/proc/self/exe", path, 4095);
+  if(n < 0){
+    stz_free(path);
+    return 0;
+  }
+  path[n] = 0;
+  return path;
+#endif
+}
+
 //     Environment Variable Setting
 //     ============================
 #ifdef PLATFORM_WINDOWS
@@ -240,67 +289,120 @@ int64_t file_time_modified (char* filename){
   return 0;
 }
 
-//============================================================
-//======================= Free List ==========================
-//============================================================
-
-typedef struct {
-  int capacity;
-  int size;
-  void** items;
-} FreeList;
-
-FreeList make_freelist (int c){
-  void** items = (void**)malloc(c * sizeof(void*));
-  FreeList f = {c, 0, items};
-  return f;
+//Writes the identity (inode), length and modification time in
+//nanoseconds of a file to metadata. Returns -1 if the file cannot be
+//stat'ed. Windows reports no inode, and times only to the second.
+int file_metadata (char* filename, int64_t* metadata){
+  struct stat attrib;
+  if(stat(filename, &attrib) != 0) return -1;
+  metadata[0] = (int64_t)attrib.st_ino;
+  metadata[1] = (int64_t)attrib.st_size;
+#if defined(PLATFORM_OS_X)
+  metadata[2] = (int64_t)attrib.st_mtimespec.tv_sec * 1000000000 + attrib.st_mtimespec.tv_nsec;
+#elif defined(PLATFORM_LINUX)
+  metadata[2] = (int64_t)attrib.st_mtim.tv_sec * 1000000000 + attrib.st_mtim.tv_nsec;
+#else
+  metadata[2] = (int64_t)attrib.st_mtime * 1000000000;
+#endif
+  return 0;
 }
 
-void ensure_capacity (FreeList* list, int c){
-  if(list->capacity < c){
-    int c2 = list->capacity;
-    while(c2 < c) c2 *= 2;
-    void** items2 = (void**)malloc(c2 * sizeof(void*));
-    memcpy(items2, list->items, list->capacity * sizeof(void*));
-    free(list->items);
-    list->items = items2;
-    list->capacity = c2;
+//             File Locks
+//             ==========
+
+//Blocks until this process holds an exclusive lock on the given file,
+//creating the file if necessary. Returns a handle for unlock_file, or
+//-1 if the file cannot be opened or locked. The lock is released when
+//the handle is closed, including when the process exits.
+#ifdef PLATFORM_WINDOWS
+  int64_t lock_file (char* filename){
+    HANDLE h = CreateFile(filename, GENERIC_READ | GENERIC_WRITE,
+                          FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                          NULL, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    if(h == INVALID_HANDLE_VALUE) return -1;
+    OVERLAPPED overlapped;
+    memset(&overlapped, 0, sizeof(overlapped));
+    if(!LockFileEx(h, LOCKFILE_EXCLUSIVE_LOCK, 0, MAXDWORD, MAXDWORD, &overlapped)){
+      CloseHandle(h);
+      return -1;
+    }
+    return (int64_t)(intptr_t)h;
   }
-}
 
-void delete_index (FreeList* list, int xi){
-  int yi = list->size - 1;
-  void* x = list->items[xi];
-  void* y = list->items[yi];
-  if(xi != yi){
-    list->items[xi] = y;
-    list->items[yi] = x;
+  int unlock_file (int64_t handle){
+    return CloseHandle((HANDLE)(intptr_t)handle) ? 0 : -1;
+  }
+#else
+  int64_t lock_file (char* filename){
+    int fd = open(filename, O_RDWR | O_CREAT, 0666);
+    if(fd < 0) return -1;
+    while(flock(fd, LOCK_EX) != 0){
+      if(errno != EINTR){
+        close(fd);
+        return -1;
+      }
+    }
+    return fd;
   }
-  list->size--;
-}
 
-void add_item (FreeList* list, void* item){
-  int i = list->size;
-  ensure_capacity(list, i + 1);
-  list->items[i] = item;
-  list->size++;
-}
+  int unlock_file (int64_t handle){
+    return close((int)handle);
+  }
+#endif
 
 //============================================================
 //================== Fixed Memory Allocator ==================
 //============================================================
 
-typedef struct {
+//The fixed memory allocator hands out blocks from a single region
+//mapped at a fixed address. Free blocks are kept in segregated
+//size classes (a two-level segregated fit allocator): the first level
+//splits sizes by powers of two, and the second level splits each
+//power of two into FM_SL_COUNT linear ranges. A bitmap per level
+//allows the smallest suitable class to be found in constant time.
+//Neighbouring free blocks are coalesced on every ffree, and free
+//blocks at the end of the region are returned to the unallocated
+//tail of the region.
+
+//Number of second level classes (log2)
+#define FM_SL_LOG2 5
+#define FM_SL_COUNT (1 << FM_SL_LOG2)
+//Alignment of all block sizes
+#define FM_ALIGN_LOG2 3
+#define FM_ALIGN (1L << FM_ALIGN_LOG2)
+//Sizes below FM_SMALL_SIZE are all placed in first level class 0
+#define FM_FL_SHIFT (FM_SL_LOG2 + FM_ALIGN_LOG2)
+#define FM_SMALL_SIZE (1L << FM_FL_SHIFT)
+//Largest supported block is 2^FM_FL_MAX bytes
+#define FM_FL_MAX 36
+#define FM_FL_COUNT (FM_FL_MAX - FM_FL_SHIFT + 1)
+
+//Flags stored in the low bits of the block size
+#define FM_FREE 1L
+#define FM_PREV_FREE 2L
+#define FM_FLAGS (FM_FREE | FM_PREV_FREE)
+
+typedef struct FBlock {
+  //Previous physical block. Only valid if FM_PREV_FREE is set.
+  struct FBlock* prev_phys;
+  //Size of the payload, and the FM_FREE and FM_PREV_FREE flags.
   long size;
-  char bytes[];
-} Chunk;
+  //Free list links. Overlaps with the payload, and only
+  //valid if FM_FREE is set.
+  struct FBlock* next_free;
+  struct FBlock* prev_free;
+} FBlock;
+
+#define FM_HEADER_SIZE ((long)(2 * sizeof(void*)))
+#define FM_MIN_SIZE ((long)(2 * sizeof(void*)))
 
 char* mem_top;
 char* mem_limit;
-FreeList mem_chunks;
+uint32_t mem_fl_bitmap;
+uint32_t mem_sl_bitmap[FM_FL_COUNT];
+FBlock* mem_free_lists[FM_FL_COUNT][FM_SL_COUNT];
 
 void init_fmalloc () {
-  mem_chunks = make_freelist(8);
   long size = 8L * 1024L * 1024L * 1024L;
   mem_top = (char*)0x700000000L;
   mem_limit = mem_top + size;
@@ -310,53 +412,191 @@ void init_fmalloc () {
                       MAP_ANONYMOUS | MAP_PRIVATE | MAP_FIXED,
                       0,
                       0);
-  if(!result){
+  if(result == MAP_FAILED){
     printf("Could not allocate fixed memory.\n");
     exit(-1);
-  }  
+  }
+  mem_fl_bitmap = 0;
+  memset(mem_sl_bitmap, 0, sizeof(mem_sl_bitmap));
+  memset(mem_free_lists, 0, sizeof(mem_free_lists));
+}
+
+//------------------------------------------------------------
+//------------------- Block Utilities ------------------------
+//------------------------------------------------------------
+
+static inline long block_size (FBlock* b){
+  return b->size & ~FM_FLAGS;
+}
+
+static inline void* block_payload (FBlock* b){
+  return (char*)b + FM_HEADER_SIZE;
+}
+
+static inline FBlock* payload_block (void* ptr){
+  return (FBlock*)((char*)ptr - FM_HEADER_SIZE);
+}
+
+//Returns NULL if b is the last block before the unallocated tail.
+static inline FBlock* next_phys_block (FBlock* b){
+  char* next = (char*)block_payload(b) + block_size(b);
+  return next == mem_top ? NULL : (FBlock*)next;
+}
+
+//Index of most significant set bit.
+static inline int fm_fls (long x){
+  return 63 - __builtin_clzl((unsigned long)x);
+}
+
+//Compute the size class of a block of the given size.
+static inline void fm_mapping (long size, int* fl, int* sl){
+  if(size < FM_SMALL_SIZE){
+    *fl = 0;
+    *sl = (int)(size >> FM_ALIGN_LOG2);
+  }else{
+    int f = fm_fls(size);
+    *sl = (int)((size >> (f - FM_SL_LOG2)) ^ (1L << FM_SL_LOG2));
+    *fl = f - (FM_FL_SHIFT - 1);
+  }
+}
+
+//Compute the smallest size class whose blocks are all guaranteed
+//to be large enough to hold the given size.
+static inline void fm_mapping_search (long size, int* fl, int* sl){
+  if(size >= FM_SMALL_SIZE)
+    size += (1L << (fm_fls(size) - FM_SL_LOG2)) - 1;
+  fm_mapping(size, fl, sl);
+}
+
+//------------------------------------------------------------
+//------------------- Free Lists -----------------------------
+//------------------------------------------------------------
+
+static void insert_free_block (FBlock* b){
+  int fl, sl;
+  fm_mapping(block_size(b), &fl, &sl);
+  FBlock* head = mem_free_lists[fl][sl];
+  b->next_free = head;
+  b->prev_free = NULL;
+  if(head) head->prev_free = b;
+  mem_free_lists[fl][sl] = b;
+  mem_fl_bitmap |= 1U << fl;
+  mem_sl_bitmap[fl] |= 1U << sl;
+}
+
+static void remove_free_block (FBlock* b){
+  int fl, sl;
+  fm_mapping(block_size(b), &fl, &sl);
+  if(b->prev_free) b->prev_free->next_free = b->next_free;
+  else mem_free_lists[fl][sl] = b->next_free;
+  if(b->next_free) b->next_free->prev_free = b->prev_free;
+  if(!mem_free_lists[fl][sl]){
+    mem_sl_bitmap[fl] &= ~(1U << sl);
+    if(!mem_sl_bitmap[fl])
+      mem_fl_bitmap &= ~(1U << fl);
+  }
+}
+
+//Find and remove a free block of at least the given size.
+//Returns NULL if there is none.
+static FBlock* find_free_block (long size){
+  int fl, sl;
+  fm_mapping_search(size, &fl, &sl);
+  if(fl >= FM_FL_COUNT) return NULL;
+  uint32_t sl_map = mem_sl_bitmap[fl] & (~0U << sl);
+  if(!sl_map){
+    uint32_t fl_map = fl + 1 < 32 ? mem_fl_bitmap & (~0U << (fl + 1)) : 0;
+    if(!fl_map) return NULL;
+    fl = __builtin_ctz(fl_map);
+    sl_map = mem_sl_bitmap[fl];
+  }
+  sl = __builtin_ctz(sl_map);
+  FBlock* b = mem_free_lists[fl][sl];
+  remove_free_block(b);
+  return b;
 }
 
-Chunk* alloc_chunk (long size){  
-  long total_size = (size + sizeof(Chunk) + 7) & -8;
-  Chunk* chunk = (Chunk*)mem_top;
-  mem_top += total_size;
+//------------------------------------------------------------
+//------------------- Allocation -----------------------------
+//------------------------------------------------------------
+
+//Carve a new block of the given size out of the unallocated tail.
+//The block before the tail is never free, so FM_PREV_FREE is not set.
+static FBlock* alloc_tail_block (long size){
+  FBlock* b = (FBlock*)mem_top;
+  mem_top += FM_HEADER_SIZE + size;
   if(mem_top > mem_limit){
     printf("Out of fixed memory.\n");
     exit(-1);
   }
-  chunk->size = size;
-  return chunk;
+  b->size = size;
+  return b;
 }
 
-Chunk* find_chunk (long size){
-  Chunk* best = 0;
-  int besti = 0;
-  for(int i=0; i<mem_chunks.size; i++){
-    Chunk* c = mem_chunks.items[i];
-    int is_best = 0;
-    if(c->size >= size){
-      if(best) is_best = c->size < best->size;
-      else is_best = 1;
-    }
-    if(is_best){
-      best = c;
-      besti = i;
-    }
+//Mark the free block b as used, and return any excess space
+//beyond the given size to the free lists.
+static void use_free_block (FBlock* b, long size){
+  long bsize = block_size(b);
+  long prev_flag = b->size & FM_PREV_FREE;
+  FBlock* next = next_phys_block(b);
+  if(bsize - size >= FM_HEADER_SIZE + FM_MIN_SIZE){
+    FBlock* rest = (FBlock*)((char*)block_payload(b) + size);
+    rest->size = (bsize - size - FM_HEADER_SIZE) | FM_FREE;
+    if(next) next->prev_phys = rest;
+    insert_free_block(rest);
+    b->size = size | prev_flag;
+  }else{
+    b->size = bsize | prev_flag;
+    if(next) next->size &= ~FM_PREV_FREE;
   }
-  if(best)
-    delete_index(&mem_chunks, besti);
-  return best;
 }
 
 void* fmalloc (long size){
-  Chunk* c = find_chunk(size);
-  if(!c) c = alloc_chunk(size);
-  return c->bytes;
+  size = (size + FM_ALIGN - 1) & ~(FM_ALIGN - 1);
+  if(size < FM_MIN_SIZE) size = FM_MIN_SIZE;
+  FBlock* b = find_free_block(size);
+  if(b) use_free_block(b, size);
+  else b = alloc_tail_block(size);
+  return block_payload(b);
 }
 
 void ffree (void* ptr){
-  Chunk* c = (Chunk*)((char*)ptr - sizeof(Chunk));
-  add_item(&mem_chunks, c);
+  FBlock* b = payload_block(ptr);
+  long size = block_size(b);
+
+  //Coalesce with previous block
+  if(b->size & FM_PREV_FREE){
+    FBlock* prev = b->prev_phys;
+    remove_free_block(prev);
+    size += block_size(prev) + FM_HEADER_SIZE;
+    prev->size = size | (prev->size & FM_PREV_FREE);
+    b = prev;
+  }
+
+  //Return to the unallocated tail if b is the last block
+  FBlock* next = next_phys_block(b);
+  if(!next){
+    mem_top = (char*)b;
+    return;
+  }
+
+  //Coalesce with next block
+  if(next->size & FM_FREE){
+    remove_free_block(next);
+    size += block_size(next) + FM_HEADER_SIZE;
+    b->size = size | (b->size & FM_PREV_FREE);
+    next = next_phys_block(b);
+    if(!next){
+      mem_top = (char*)b;
+      return;
+    }
+  }
+
+  //Add to free lists
+  b->size |= FM_FREE;
+  insert_free_block(b);
+  next->prev_phys = b;
+  next->size |= FM_PREV_FREE;
 }
 
 //============================================================
@@ -446,6 +686,150 @@ StringList* list_dir (char* filename){
   return 0;
 }
 
+//             Directory Walking
+//             =================
+
+//A directory walk returns every entry below a directory, with its path
+//relative to the directory, its file type (as in get_file_type), and
+//optionally its modification time. The entry type is taken from d_type
+//when the platform provides it, so a separate stat is only needed for
+//entries of unknown type or when modification times are requested.
+//Subdirectories that cannot be opened are skipped. Symbolic links to
+//directories are reported but not descended into.
+
+#define WALK_RECURSIVE 1
+#define WALK_TIMES 2
+
+typedef struct {
+  int n;
+  int capacity;
+  char** names;
+  int* types;
+  int64_t* times;
+} DirEntryList;
+
+DirEntryList* make_direntrylist (int capacity){
+  DirEntryList* list = (DirEntryList*)malloc(sizeof(DirEntryList));
+  list->n = 0;
+  list->capacity = capacity;
+  list->names = (char**)malloc(capacity * sizeof(char*));
+  list->types = (int*)malloc(capacity * sizeof(int));
+  list->times = (int64_t*)malloc(capacity * sizeof(int64_t));
+  return list;
+}
+
+void free_direntrylist (DirEntryList* list){
+  for(int i=0; i<list->n; i++)
+    free(list->names[i]);
+  free(list->names);
+  free(list->types);
+  free(list->times);
+  free(list);
+}
+
+static void direntrylist_add (DirEntryList* list, char* name, int type, int64_t time){
+  if(list->n == list->capacity){
+    list->capacity *= 2;
+    list->names = (char**)realloc(list->names, list->capacity * sizeof(char*));
+    list->types = (int*)realloc(list->types, list->capacity * sizeof(int));
+    list->times = (int64_t*)realloc(list->times, list->capacity * sizeof(int64_t));
+  }
+  list->names[list->n] = name;
+  list->types[list->n] = type;
+  list->times[list->n] = time;
+  list->n++;
+}
+
+static int stat_file_type (struct stat* s){
+  if(S_ISREG(s->st_mode)) return 0;
+  else if(S_ISDIR(s->st_mode)) return 1;
+  else return 2;
+}
+
+//Walk the directory at path, whose entries are named relative to prefix.
+static int walk_dir_into (char* path, char* prefix, int flags, DirEntryList* list){
+  DIR* dir = opendir(path);
+  if(dir == NULL) return -1;
+  long path_len = strlen(path);
+  long prefix_len = strlen(prefix);
+  while(1){
+    struct dirent* entry = readdir(dir);
+    if(entry == NULL) break;
+    char* name = entry->d_name;
+    if(strcmp(name, ".") == 0 || strcmp(name, "..") == 0) continue;
+    long name_len = strlen(name);
+
+    //Full path of the entry, used for stat and recursion
+    char* full = (char*)malloc(path_len + name_len + 2);
+    memcpy(full, path, path_len);
+    full[path_len] = '/';
+    memcpy(full + path_len + 1, name, name_len + 1);
+
+    //Determine type, and whether the entry is a real directory
+    int type = -1;
+    int real_dir = 0;
+#ifdef DT_DIR
+    if(entry->d_type == DT_REG)
+      type = 0;
+    else if(entry->d_type == DT_DIR){
+      type = 1;
+      real_dir = 1;
+    }
+    else if(entry->d_type != DT_UNKNOWN && entry->d_type != DT_LNK)
+      type = 2;
+#endif
+    int64_t time = 0;
+    if(type < 0 || (flags & WALK_TIMES)){
+      struct stat s;
+      if(stat(full, &s) == 0){
+        if(type < 0){
+          type = stat_file_type(&s);
+#ifdef DT_DIR
+          real_dir = type == 1 && entry->d_type != DT_LNK;
+#else
+          real_dir = type == 1;
+#endif
+        }
+        time = (int64_t)s.st_mtime;
+      }
+      else if(type < 0){
+        //Dangling link, or the entry was removed during the walk.
+        type = 2;
+      }
+    }
+
+    //Record the entry under its relative name
+    char* rel = (char*)malloc(prefix_len + name_len + 1);
+    memcpy(rel, prefix, prefix_len);
+    memcpy(rel + prefix_len, name, name_len + 1);
+    direntrylist_add(list, rel, type, time);
+
+    //Descend into subdirectories
+    if(real_dir && (flags & WALK_RECURSIVE)){
+      char* subprefix = (char*)malloc(prefix_len + name_len + 2);
+      memcpy(subprefix, rel, prefix_len + name_len);
+      subprefix[prefix_len + name_len] = '/';
+      subprefix[prefix_len + name_len + 1] = '\0';
+      walk_dir_into(full, subprefix, flags, list);
+      free(subprefix);
+    }
+    free(full);
+  }
+  closedir(dir);
+  return 0;
+}
+
+DirEntryList* walk_dir (char* path, int flags){
+  DirEntryList* list = make_direntrylist(16);
+  if(walk_dir_into(path, "", flags, list) < 0){
+    int code = errno;
+    free_direntrylist(list);
+    errno = code;
+    return 0;
+  }
+  return list;
+}
+
 //============================================================
 //===================== Sleeping =============================
 //============================================================
@@ -458,503 +842,2558 @@ int sleep_us (long us){
 }
 
 //============================================================
-//================= Stanza Memory Allocator ==================
+//===================== String Kernels =======================
 //============================================================
 
-void* stz_malloc (long size){
-  #if defined(FMALLOC)
-    return fmalloc(size);
-  #else
-    return malloc(size);
-  #endif
-}
+//Searching, scanning and case mapping over the bytes of a String.
+//Blocks of 16 bytes are processed with SSE2, which every x86-64
+//processor provides. A scalar loop handles the remaining bytes, and
+//the whole input when SSE2 is unavailable. Searches return an index
+//relative to the start of the given bytes, or -1 if nothing is found.
 
-void stz_free (void* ptr){
-  #if defined(FMALLOC)
-    ffree(ptr);
-  #else
-    free(ptr);
-  #endif
+long stz_index_of_byte (const char* p, long n, int c){
+  const char* r = (const char*)memchr(p, c, n);
+  return r == NULL ? -1 : r - p;
 }
 
-//============================================================
-//================= Process Runtime ==========================
-//============================================================
-#if defined(PLATFORM_OS_X) || defined(PLATFORM_LINUX)
-
-//------------------------------------------------------------
-//------------------- Structures -----------------------------
-//------------------------------------------------------------
-
-typedef struct {
-  long pid;
-  int pipeid;
-  FILE* in;
-  FILE* out;
-  FILE* err;
-} Process;
+long stz_last_index_of_byte (const char* p, long n, int c){
+  long i = n;
+#if defined(__SSE2__)
+  __m128i vc = _mm_set1_epi8((char)c);
+  for(; i >= 16; i -= 16){
+    __m128i x = _mm_loadu_si128((const __m128i*)(p + i - 16));
+    int m = _mm_movemask_epi8(_mm_cmpeq_epi8(x, vc));
+    if(m) return i - 16 + 31 - __builtin_clz(m);
+  }
+#endif
+  while(i > 0){
+    i--;
+    if(p[i] == (char)c) return i;
+  }
+  return -1;
+}
 
-typedef struct {
-  int state;
-  int code;
-} ProcessState;
+//Candidate positions are those where both the first and the last
+//byte of q match. Only the candidates are compared in full.
+long stz_index_of_bytes (const char* p, long n, const char* q, long m){
+  if(m == 0) return 0;
+  if(m > n) return -1;
+  if(m == 1) return stz_index_of_byte(p, n, (unsigned char)q[0]);
+  long last = n - m;
+  long i = 0;
+#if defined(__SSE2__)
+  __m128i vfirst = _mm_set1_epi8(q[0]);
+  __m128i vlast = _mm_set1_epi8(q[m - 1]);
+  for(; i + 15 <= last; i += 16){
+    __m128i a = _mm_loadu_si128((const __m128i*)(p + i));
+    __m128i b = _mm_loadu_si128((const __m128i*)(p + i + m - 1));
+    unsigned int mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, vfirst),
+                                                        _mm_cmpeq_epi8(b, vlast)));
+    while(mask){
+      int k = __builtin_ctz(mask);
+      if(memcmp(p + i + k + 1, q + 1, m - 2) == 0) return i + k;
+      mask &= mask - 1;
+    }
+  }
+#endif
+  for(; i <= last; i++){
+    if(p[i] == q[0] && p[i + m - 1] == q[m - 1] &&
+       memcmp(p + i + 1, q + 1, m - 2) == 0)
+      return i;
+  }
+  return -1;
+}
 
-typedef struct {
-  char* pipe;
-  char* in_pipe;
-  char* out_pipe;
-  char* err_pipe;
-  char* file;
-  char** argvs;
-} EvalArg;
+long stz_last_index_of_bytes (const char* p, long n, const char* q, long m){
+  if(m == 0) return n;
+  if(m > n) return -1;
+  long i = n - m + 1;
+  while(i > 0){
+    long j = stz_last_index_of_byte(p, i, (unsigned char)q[0]);
+    if(j < 0) return -1;
+    if(memcmp(p + j, q, m) == 0) return j;
+    i = j;
+  }
+  return -1;
+}
 
-#define PROCESS_RUNNING 0
-#define PROCESS_DONE 1
-#define PROCESS_TERMINATED 2
-#define PROCESS_STOPPED 3
+//Copy n bytes from src to dst, replacing each occurrence of the byte
+//a with the byte b.
+void stz_replace_byte (char* dst, const char* src, long n, int a, int b){
+  long i = 0;
+#if defined(__SSE2__)
+  __m128i va = _mm_set1_epi8((char)a);
+  __m128i vb = _mm_set1_epi8((char)b);
+  for(; i + 16 <= n; i += 16){
+    __m128i x = _mm_loadu_si128((const __m128i*)(src + i));
+    __m128i eq = _mm_cmpeq_epi8(x, va);
+    __m128i y = _mm_or_si128(_mm_and_si128(eq, vb), _mm_andnot_si128(eq, x));
+    _mm_storeu_si128((__m128i*)(dst + i), y);
+  }
+#endif
+  for(; i < n; i++)
+    dst[i] = src[i] == (char)a ? (char)b : src[i];
+}
 
-#define STANDARD_IN 0
-#define STANDARD_OUT 1
-#define PROCESS_IN 2
-#define PROCESS_OUT 3
-#define STANDARD_ERR 4
-#define PROCESS_ERR 5
-#define NUM_STREAM_SPECS 6
+//Replace each non-overlapping occurrence of q in p with r, scanning
+//from the left. Returns the length of the result, and writes the
+//result to dst unless dst is NULL. q must not be empty.
+long stz_replace_bytes (char* dst, const char* p, long n,
+                        const char* q, long m, const char* r, long k){
+  long len = 0;
+  long i = 0;
+  while(1){
+    long j = stz_index_of_bytes(p + i, n - i, q, m);
+    long seg = j < 0 ? n - i : j;
+    if(dst != NULL) memcpy(dst + len, p + i, seg);
+    len += seg;
+    if(j < 0) return len;
+    if(dst != NULL) memcpy(dst + len, r, k);
+    len += k;
+    i += j + m;
+  }
+}
 
-#define RETURN_NEG(x) {int r=(x); if(r < 0) return -1;}
+//Copy n bytes from src to dst, flipping the case of the bytes
+//between lo and hi, which are ASCII letters of a single case.
+static void map_case (char* dst, const char* src, long n, char lo, char hi){
+  long i = 0;
+#if defined(__SSE2__)
+  __m128i vlo = _mm_set1_epi8(lo - 1);
+  __m128i vhi = _mm_set1_epi8(hi + 1);
+  __m128i vbit = _mm_set1_epi8(0x20);
+  for(; i + 16 <= n; i += 16){
+    __m128i x = _mm_loadu_si128((const __m128i*)(src + i));
+    __m128i in = _mm_and_si128(_mm_cmpgt_epi8(x, vlo), _mm_cmplt_epi8(x, vhi));
+    _mm_storeu_si128((__m128i*)(dst + i), _mm_xor_si128(x, _mm_and_si128(in, vbit)));
+  }
+#endif
+  for(; i < n; i++){
+    char c = src[i];
+    dst[i] = (c >= lo && c <= hi) ? c ^ 0x20 : c;
+  }
+}
 
-//------------------------------------------------------------
-//-------------------- Utilities -----------------------------
-//------------------------------------------------------------
+void stz_lower_case (char* dst, const char* src, long n){
+  map_case(dst, src, n, 'A', 'Z');
+}
 
-void exit_with_error (){
-  fprintf(stderr, "%s\n", strerror(errno));
-  exit(-1);
+void stz_upper_case (char* dst, const char* src, long n){
+  map_case(dst, src, n, 'a', 'z');
 }
 
-int count_non_null (void** xs){
-  int n=0;
-  while(xs[n] != NULL)
-    n++;
-  return n;
+//The whitespace removed by trim: space, newline, tab, backspace and
+//carriage return.
+static inline int trim_space (char c){
+  return c == ' ' || c == '\n' || c == '\t' || c == '\b' || c == '\r';
 }
 
-char* string_join (char* a, char* b){
-  int len = strlen(a) + strlen(b);
-  char* buffer = (char*)stz_malloc(len + 1);
-  sprintf(buffer, "%s%s", a, b);
-  return buffer;
+#if defined(__SSE2__)
+static inline int trim_space_mask (__m128i x){
+  __m128i m = _mm_or_si128(_mm_cmpeq_epi8(x, _mm_set1_epi8(' ')),
+                           _mm_cmpeq_epi8(x, _mm_set1_epi8('\n')));
+  m = _mm_or_si128(m, _mm_cmpeq_epi8(x, _mm_set1_epi8('\t')));
+  m = _mm_or_si128(m, _mm_cmpeq_epi8(x, _mm_set1_epi8('\b')));
+  m = _mm_or_si128(m, _mm_cmpeq_epi8(x, _mm_set1_epi8('\r')));
+  return _mm_movemask_epi8(m);
 }
+#endif
 
-//Opening a named pipe
-int open_pipe (char* prefix, char* suffix, int options){
-  char* name = string_join(prefix, suffix);
-  int fd = open(name, options);
-  stz_free(name);
-  return fd;
+//Returns the index of the first byte that is not whitespace, or n.
+long stz_skip_space (const char* p, long n){
+  long i = 0;
+#if defined(__SSE2__)
+  for(; i + 16 <= n; i += 16){
+    int m = trim_space_mask(_mm_loadu_si128((const __m128i*)(p + i))) ^ 0xFFFF;
+    if(m) return i + __builtin_ctz(m);
+  }
+#endif
+  while(i < n && trim_space(p[i])) i++;
+  return i;
 }
 
-//Creating a named pipe
-int make_pipe (char* prefix, char* suffix){
-  char* name = string_join(prefix, suffix);
-  return mkfifo(name, S_IRUSR|S_IWUSR);
+//Returns one past the index of the last byte that is not whitespace, or 0.
+long stz_skip_space_back (const char* p, long n){
+  long i = n;
+#if defined(__SSE2__)
+  for(; i >= 16; i -= 16){
+    int m = trim_space_mask(_mm_loadu_si128((const __m128i*)(p + i - 16))) ^ 0xFFFF;
+    if(m) return i - 16 + 32 - __builtin_clz(m);
+  }
+#endif
+  while(i > 0 && trim_space(p[i - 1])) i--;
+  return i;
 }
 
-//------------------------------------------------------------
-//----------------------- Serialization ----------------------
-//------------------------------------------------------------
+//============================================================
+//====================== Array Sorting =======================
+//============================================================
 
-// ===== Serialization =====
-void write_int (FILE* f, int x){
-  fwrite(&x, sizeof(int), 1, f);
-}
-void write_long (FILE* f, long x){
-  fwrite(&x, sizeof(long), 1, f);
-}
-void write_string (FILE* f, char* s){
-  if(s == NULL)
-    write_int(f, -1);
-  else{
-    int n = strlen(s);
-    write_int(f, n);
-    fwrite(s, 1, n, f);
+//Comparison-free sorts for the primitive arrays. Bytes are sorted by
+//counting. Ints, longs and doubles are mapped to unsigned integers
+//with the same order, and sorted by a least significant digit radix
+//sort on 8-bit digits. A digit that is the same for every element is
+//skipped. Short arrays are sorted by insertion.
+
+#define SORT_INSERTION_LIMIT 64
+
+void stz_sort_bytes (uint8_t* xs, long n){
+  long counts[256] = {0};
+  for(long i = 0; i < n; i++)
+    counts[xs[i]]++;
+  long k = 0;
+  for(int v = 0; v < 256; v++){
+    memset(xs + k, v, counts[v]);
+    k += counts[v];
   }
 }
-void write_strings (FILE* f, char** s){
-  int n = count_non_null((void**)s);
-  write_int(f, n);
-  for(int i=0; i<n; i++)
-    write_string(f, s[i]);
-}
-void write_earg (FILE* f, EvalArg* earg){
-  write_string(f, earg->pipe);
-  write_string(f, earg->in_pipe);
-  write_string(f, earg->out_pipe);
-  write_string(f, earg->err_pipe);
-  write_string(f, earg->file);
-  write_strings(f, earg->argvs);
-}
-void write_process_state (FILE* f, ProcessState* s){
-  write_int(f, s->state);
-  write_int(f, s->code);
-}
 
-// ===== Deserialization =====
-void bread (void* xs0, int size, int n0, FILE* f){
-  char* xs = xs0;
-  int n = n0;
-  while(n > 0){
-    int c = fread(xs, size, n, f);
-    if(c < n){
-      if(ferror(f)) exit_with_error();
-      if(feof(f)) return;
+static void radix_sort_u32 (uint32_t* xs, long n){
+  if(n < SORT_INSERTION_LIMIT){
+    for(long i = 1; i < n; i++){
+      uint32_t x = xs[i];
+      long j = i;
+      for(; j > 0 && xs[j - 1] > x; j--) xs[j] = xs[j - 1];
+      xs[j] = x;
     }
-    n = n - c;
-    xs = xs + size*c;
+    return;
   }
+  long counts[4][256];
+  memset(counts, 0, sizeof(counts));
+  for(long i = 0; i < n; i++){
+    uint32_t x = xs[i];
+    for(int d = 0; d < 4; d++)
+      counts[d][(x >> (8 * d)) & 255]++;
+  }
+  uint32_t* buf = (uint32_t*)stz_malloc(n * sizeof(uint32_t));
+  uint32_t* src = xs;
+  uint32_t* dst = buf;
+  for(int d = 0; d < 4; d++){
+    int shift = 8 * d;
+    if(counts[d][(src[0] >> shift) & 255] == n) continue;
+    long offsets[256];
+    long sum = 0;
+    for(int v = 0; v < 256; v++){
+      offsets[v] = sum;
+      sum += counts[d][v];
+    }
+    for(long i = 0; i < n; i++){
+      uint32_t x = src[i];
+      dst[offsets[(x >> shift) & 255]++] = x;
+    }
+    uint32_t* tmp = src;
+    src = dst;
+    dst = tmp;
+  }
+  if(src != xs) memcpy(xs, src, n * sizeof(uint32_t));
+  stz_free(buf);
 }
-int read_int (FILE* f){
-  int n;
-  bread(&n, sizeof(int), 1, f);
-  return n;
-}
-long read_long (FILE* f){
-  long n;
-  bread(&n, sizeof(long), 1, f);
-  return n;
-}
-char* read_string (FILE* f){
-  int n = read_int(f);
-  if(n < 0)
-    return NULL;
-  else{    
-    char* s = (char*)stz_malloc(n + 1);
-    bread(s, 1, n, f);
-    s[n] = '\0';
-    return s;
+
+static void radix_sort_u64 (uint64_t* xs, long n){
+  if(n < SORT_INSERTION_LIMIT){
+    for(long i = 1; i < n; i++){
+      uint64_t x = xs[i];
+      long j = i;
+      for(; j > 0 && xs[j - 1] > x; j--) xs[j] = xs[j - 1];
+      xs[j] = x;
+    }
+    return;
+  }
+  long counts[8][256];
+  memset(counts, 0, sizeof(counts));
+  for(long i = 0; i < n; i++){
+    uint64_t x = xs[i];
+    for(int d = 0; d < 8; d++)
+      counts[d][(x >> (8 * d)) & 255]++;
+  }
+  uint64_t* buf = (uint64_t*)stz_malloc(n * sizeof(uint64_t));
+  uint64_t* src = xs;
+  uint64_t* dst = buf;
+  for(int d = 0; d < 8; d++){
+    int shift = 8 * d;
+    if(counts[d][(src[0] >> shift) & 255] == n) continue;
+    long offsets[256];
+    long sum = 0;
+    for(int v = 0; v < 256; v++){
+      offsets[v] = sum;
+      sum += counts[d][v];
+    }
+    for(long i = 0; i < n; i++){
+      uint64_t x = src[i];
+      dst[offsets[(x >> shift) & 255]++] = x;
+    }
+    uint64_t* tmp = src;
+    src = dst;
+    dst = tmp;
   }
+  if(src != xs) memcpy(xs, src, n * sizeof(uint64_t));
+  stz_free(buf);
 }
-char** read_strings (FILE* f){
-  int n = read_int(f);
-  char** xs = (char**)stz_malloc(sizeof(char*)*(n + 1));
-  for(int i=0; i<n; i++)
-    xs[i] = read_string(f);
-  xs[n] = NULL;
-  return xs;
-}
-EvalArg* read_earg (FILE* f){
-  EvalArg* earg = (EvalArg*)stz_malloc(sizeof(EvalArg));
-  earg->pipe = read_string(f);
-  earg->in_pipe = read_string(f);
-  earg->out_pipe = read_string(f);
-  earg->err_pipe = read_string(f);
-  earg->file = read_string(f);
-  earg->argvs = read_strings(f);
-  return earg;
-}
-void read_process_state (FILE* f, ProcessState* s){  
-  s->state = read_int(f);
-  s->code = read_int(f);
-}
-
-//===== Free =====
-void free_earg (EvalArg* arg){
-  stz_free(arg->pipe);
-  if(arg->in_pipe != NULL) stz_free(arg->in_pipe);
-  if(arg->out_pipe != NULL) stz_free(arg->out_pipe);
-  if(arg->err_pipe != NULL) stz_free(arg->err_pipe);
-  stz_free(arg->file);
-  for(int i=0; arg->argvs[i] != NULL; i++)
-    stz_free(arg->argvs[i]);
-  stz_free(arg->argvs);
+
+//Flipping the sign bit orders signed integers as unsigned integers.
+void stz_sort_ints (int32_t* xs, long n){
+  uint32_t* us = (uint32_t*)xs;
+  for(long i = 0; i < n; i++) us[i] ^= 0x80000000u;
+  radix_sort_u32(us, n);
+  for(long i = 0; i < n; i++) us[i] ^= 0x80000000u;
 }
 
-//------------------------------------------------------------
-//-------------------- Process Queries -----------------------
-//------------------------------------------------------------
+void stz_sort_longs (int64_t* xs, long n){
+  uint64_t* us = (uint64_t*)xs;
+  for(long i = 0; i < n; i++) us[i] ^= 0x8000000000000000ull;
+  radix_sort_u64(us, n);
+  for(long i = 0; i < n; i++) us[i] ^= 0x8000000000000000ull;
+}
 
-void get_process_state (long pid, ProcessState* s, int wait_for_termination){
-  int status;
-  int ret = waitpid(pid, &status, wait_for_termination? 0 : WNOHANG);  
-  
-  if(ret == 0)
-    *s = (ProcessState){PROCESS_RUNNING, 0};
-  else if(WIFEXITED(status))
-    *s = (ProcessState){PROCESS_DONE, WEXITSTATUS(status)};
-  else if(WIFSIGNALED(status))
-    *s = (ProcessState){PROCESS_TERMINATED, WTERMSIG(status)};
-  else if(WIFSTOPPED(status))
-    *s = (ProcessState){PROCESS_STOPPED, WSTOPSIG(status)};
-  else
-    *s = (ProcessState){PROCESS_RUNNING, 0};
+//Negative doubles have all their bits flipped, and positive doubles
+//their sign bit, which orders them as unsigned integers. NaNs are
+//placed at the ends according to their sign bit.
+void stz_sort_doubles (double* xs, long n){
+  uint64_t* us = (uint64_t*)xs;
+  const uint64_t sign = 0x8000000000000000ull;
+  for(long i = 0; i < n; i++)
+    us[i] = (us[i] & sign) ? ~us[i] : us[i] | sign;
+  radix_sort_u64(us, n);
+  for(long i = 0; i < n; i++)
+    us[i] = (us[i] & sign) ? us[i] & ~sign : ~us[i];
 }
 
-//------------------------------------------------------------
-//---------------------- Launcher Main -----------------------
-//------------------------------------------------------------
+//============================================================
+//========================= Hashing ==========================
+//============================================================
 
-#define LAUNCH_COMMAND 0
-#define STATE_COMMAND 1
-#define WAIT_COMMAND 2
+//Hash of a block of bytes, in the style of wyhash. Each step
+//multiplies two 64-bit words into a 128-bit product and folds its
+//halves together. Long inputs are consumed 48 bytes at a time in
+//three independent lanes. Inputs of at most 16 bytes are read as a
+//few overlapping words, without a loop.
 
-void write_error_and_exit (int fd){
-  int code = errno;
-  write(fd, &code, sizeof(int));
-  close(fd);
-  exit(-1);
+static const uint64_t HASH_SECRET0 = 0xa0761d6478bd642full;
+static const uint64_t HASH_SECRET1 = 0xe7037ed1a0b428dbull;
+static const uint64_t HASH_SECRET2 = 0x8ebc6af09c88c6e3ull;
+static const uint64_t HASH_SECRET3 = 0x589965cc75374cc3ull;
+
+static inline uint64_t hash_mix (uint64_t a, uint64_t b){
+  __uint128_t r = (__uint128_t)a * b;
+  return (uint64_t)r ^ (uint64_t)(r >> 64);
 }
 
-void launcher_main (FILE* lin, FILE* lout){
-  while(1){
-    //Read in command
-    int comm = fgetc(lin);
-    if(feof(lin)) exit(0);
-
-    //Interpret launch process command
-    if(comm == LAUNCH_COMMAND){
-      //Read in evaluation arguments
-      EvalArg* earg = read_earg(lin);
-      if(feof(lin)) exit(0);
-
-      //Create error-code pipe
-      int READ = 0;
-      int WRITE = 1;
-      int exec_error[2];
-      if(pipe(exec_error) < 0) exit_with_error();
-
-      //Fork a new child
-      long pid = (long)fork();
-      if(pid < 0) exit_with_error();
-
-      if(pid > 0){
-        //Read from error-code pipe
-        int exec_code;
-        close(exec_error[WRITE]);
-        int exec_r = read(exec_error[READ], &exec_code, sizeof(int));
-        close(exec_error[READ]);
-        
-        if(exec_r == 0){
-          //Exec evaluated successfully
-          //Return new process id
-          write_long(lout, pid);
-          fflush(lout);          
-        }
-        else if(exec_r == sizeof(int)){
-          //Exec evaluated unsuccessfully
-          //Return error code as negative long
-          write_long(lout, -exec_code);
-          fflush(lout);
-        }
-        else{
-          fprintf(stderr, "Unreachable code.");
-          exit(-1);
-        }
-      }else{
-        //Close exec pipe read, and close write end on successful exec
-        close(exec_error[READ]);
-        fcntl(exec_error[WRITE], F_SETFD, FD_CLOEXEC);
-        
-        //Open named pipes
-        if(earg->in_pipe != NULL){
-          int fd = open_pipe(earg->pipe, earg->in_pipe, O_RDONLY);
-          if(fd < 0) write_error_and_exit(exec_error[WRITE]);
-          dup2(fd, 0);
-        }
-        if(earg->out_pipe != NULL){
-          int fd = open_pipe(earg->pipe, earg->out_pipe, O_WRONLY);
-          if(fd < 0) write_error_and_exit(exec_error[WRITE]);
-          dup2(fd, 1);
-        }
-        if(earg->err_pipe != NULL){
-          int fd = open_pipe(earg->pipe, earg->err_pipe, O_WRONLY);
-          if(fd < 0) write_error_and_exit(exec_error[WRITE]);
-          dup2(fd, 2);
-        }
-        
-        //Launch child process      
-        execvp(earg->file, earg->argvs);
+static inline uint64_t hash_read8 (const uint8_t* p){
+  uint64_t v;
+  memcpy(&v, p, 8);
+  return v;
+}
 
-        //Unsuccessful exec, write error number
-        write_error_and_exit(exec_error[WRITE]);
+static inline uint64_t hash_read4 (const uint8_t* p){
+  uint32_t v;
+  memcpy(&v, p, 4);
+  return v;
+}
+
+static uint64_t hash_bytes64 (const uint8_t* p, long len, uint64_t seed){
+  seed ^= hash_mix(seed ^ HASH_SECRET0, HASH_SECRET1);
+  uint64_t a, b;
+  if(len <= 16){
+    if(len >= 4){
+      long d = (len >> 3) << 2;
+      a = (hash_read4(p) << 32) | hash_read4(p + d);
+      b = (hash_read4(p + len - 4) << 32) | hash_read4(p + len - 4 - d);
+    }else if(len > 0){
+      a = ((uint64_t)p[0] << 16) | ((uint64_t)p[len >> 1] << 8) | p[len - 1];
+      b = 0;
+    }else{
+      a = b = 0;
+    }
+  }else{
+    long i = len;
+    if(i > 48){
+      uint64_t seed1 = seed, seed2 = seed;
+      do{
+        seed = hash_mix(hash_read8(p) ^ HASH_SECRET1, hash_read8(p + 8) ^ seed);
+        seed1 = hash_mix(hash_read8(p + 16) ^ HASH_SECRET2, hash_read8(p + 24) ^ seed1);
+        seed2 = hash_mix(hash_read8(p + 32) ^ HASH_SECRET3, hash_read8(p + 40) ^ seed2);
+        p += 48;
+        i -= 48;
+      }while(i > 48);
+      seed ^= seed1 ^ seed2;
+    }
+    while(i > 16){
+      seed = hash_mix(hash_read8(p) ^ HASH_SECRET1, hash_read8(p + 8) ^ seed);
+      p += 16;
+      i -= 16;
+    }
+    //The last 16 bytes, which may overlap bytes already consumed.
+    a = hash_read8(p + i - 16);
+    b = hash_read8(p + i - 8);
+  }
+  __uint128_t r = (__uint128_t)(a ^ HASH_SECRET1) * (b ^ seed);
+  return hash_mix((uint64_t)r ^ HASH_SECRET0 ^ (uint64_t)len,
+                  (uint64_t)(r >> 64) ^ HASH_SECRET1);
+}
+
+int stz_hash_bytes (const void* p, long len){
+  uint64_t h = hash_bytes64((const uint8_t*)p, len, 0);
+  return (int)(h ^ (h >> 32));
+}
+
+//============================================================
+//===================== Mapped Files =========================
+//============================================================
+
+//Maps the whole of a regular file read-only into memory, and stores
+//its length in *length. Returns NULL if the file cannot be opened or
+//is not a regular file. An empty file cannot be mapped, so it is
+//given an empty block which unmap_file ignores.
+
+static char empty_mapping[1];
+
+#ifdef PLATFORM_WINDOWS
+  char* map_file (char* filename, int64_t* length){
+    HANDLE f = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL,
+                           OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if(f == INVALID_HANDLE_VALUE) return NULL;
+    LARGE_INTEGER size;
+    if(!GetFileSizeEx(f, &size)){
+      CloseHandle(f);
+      return NULL;
+    }
+    *length = size.QuadPart;
+    if(size.QuadPart == 0){
+      CloseHandle(f);
+      return empty_mapping;
+    }
+    HANDLE m = CreateFileMapping(f, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(f);
+    if(m == NULL) return NULL;
+    char* p = (char*)MapViewOfFile(m, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(m);
+    return p;
+  }
+
+  int unmap_file (char* data, int64_t length){
+    if(length == 0) return 0;
+    return UnmapViewOfFile(data) ? 0 : -1;
+  }
+#else
+  char* map_file (char* filename, int64_t* length){
+    int fd = open(filename, O_RDONLY);
+    if(fd < 0) return NULL;
+    struct stat s;
+    if(fstat(fd, &s) < 0){
+      close(fd);
+      return NULL;
+    }
+    if(!S_ISREG(s.st_mode)){
+      close(fd);
+      errno = ENODEV;
+      return NULL;
+    }
+    *length = s.st_size;
+    if(s.st_size == 0){
+      close(fd);
+      return empty_mapping;
+    }
+    void* p = mmap(NULL, s.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(p == MAP_FAILED) return NULL;
+    return (char*)p;
+  }
+
+  int unmap_file (char* data, int64_t length){
+    if(length == 0) return 0;
+    return munmap(data, length);
+  }
+#endif
+
+//============================================================
+//===================== File Buffers =========================
+//============================================================
+
+//Write buffers of the FileOutputStreams opened by Stanza. Stanza adds
+//bytes to the buffer directly, and calls write_file_buffer to write
+//them out in bulk. The open buffers are kept in a list so that they
+//are written out when the program exits, as stdio does for its own.
+
+typedef struct FileBuffer {
+  FILE* file;
+  int64_t length;
+  int64_t capacity;
+  struct FileBuffer* next;
+  char data[];
+} FileBuffer;
+
+static FileBuffer* open_file_buffers = NULL;
+
+int write_file_buffer (FileBuffer* b, const char* p, int64_t n);
+
+static void write_open_file_buffers (void){
+  for(FileBuffer* b = open_file_buffers; b != NULL; b = b->next)
+    write_file_buffer(b, NULL, 0);
+}
+
+FileBuffer* open_file_buffer (FILE* f, int64_t capacity){
+  static int registered = 0;
+  if(!registered){
+    atexit(write_open_file_buffers);
+    registered = 1;
+  }
+  //Writes are gathered in the buffer, so the one of stdio is unused.
+  setvbuf(f, NULL, _IONBF, 0);
+  FileBuffer* b = (FileBuffer*)stz_malloc(sizeof(FileBuffer) + capacity);
+  b->file = f;
+  b->length = 0;
+  b->capacity = capacity;
+  b->next = open_file_buffers;
+  open_file_buffers = b;
+  return b;
+}
+
+void close_file_buffer (FileBuffer* b){
+  FileBuffer** r = &open_file_buffers;
+  while(*r != b) r = &(*r)->next;
+  *r = b->next;
+  stz_free(b);
+}
+
+//Writes the buffered bytes followed by the n bytes at p, and empties
+//the buffer. Returns 0, or -1 if the file could not be written.
+int write_file_buffer (FileBuffer* b, const char* p, int64_t n){
+  int64_t length = b->length;
+  b->length = 0;
+#ifdef PLATFORM_WINDOWS
+  if(fwrite(b->data, 1, length, b->file) != (size_t)length) return -1;
+  if(n > 0 && fwrite(p, 1, n, b->file) != (size_t)n) return -1;
+  return 0;
+#else
+  struct iovec vs[2] = {{b->data, length}, {(void*)p, n}};
+  struct iovec* v = vs;
+  int count = 2;
+  int fd = fileno(b->file);
+  while(count > 0){
+    if(v->iov_len == 0){
+      v++;
+      count--;
+      continue;
+    }
+    ssize_t r = writev(fd, v, count);
+    if(r < 0){
+      if(errno == EINTR) continue;
+      return -1;
+    }
+    //Skip past what was written
+    while(count > 0 && (size_t)r >= v->iov_len){
+      r -= v->iov_len;
+      v++;
+      count--;
+    }
+    if(count > 0){
+      v->iov_base = (char*)v->iov_base + r;
+      v->iov_len -= r;
+    }
+  }
+  return 0;
+#endif
+}
+
+//============================================================
+//=================== Number Formatting ======================
+//============================================================
+
+//Cached powers of ten for Grisu, 10^k for k = -348, -340, ..., 340.
+//Each is the 64-bit significand f and binary exponent e of f * 2^e.
+static const uint64_t grisu_pow_f[] = {
+  0xfa8fd5a0081c0288ULL, 0xbaaee17fa23ebf76ULL, 0x8b16fb203055ac76ULL,
+  0xcf42894a5dce35eaULL, 0x9a6bb0aa55653b2dULL, 0xe61acf033d1a45dfULL,
+  0xab70fe17c79ac6caULL, 0xff77b1fcbebcdc4fULL, 0xbe5691ef416bd60cULL,
+  0x8dd01fad907ffc3cULL, 0xd3515c2831559a83ULL, 0x9d71ac8fada6c9b5ULL,
+  0xea9c227723ee8bcbULL, 0xaecc49914078536dULL, 0x823c12795db6ce57ULL,
+  0xc21094364dfb5637ULL, 0x9096ea6f3848984fULL, 0xd77485cb25823ac7ULL,
+  0xa086cfcd97bf97f4ULL, 0xef340a98172aace5ULL, 0xb23867fb2a35b28eULL,
+  0x84c8d4dfd2c63f3bULL, 0xc5dd44271ad3cdbaULL, 0x936b9fcebb25c996ULL,
+  0xdbac6c247d62a584ULL, 0xa3ab66580d5fdaf6ULL, 0xf3e2f893dec3f126ULL,
+  0xb5b5ada8aaff80b8ULL, 0x87625f056c7c4a8bULL, 0xc9bcff6034c13053ULL,
+  0x964e858c91ba2655ULL, 0xdff9772470297ebdULL, 0xa6dfbd9fb8e5b88fULL,
+  0xf8a95fcf88747d94ULL, 0xb94470938fa89bcfULL, 0x8a08f0f8bf0f156bULL,
+  0xcdb02555653131b6ULL, 0x993fe2c6d07b7facULL, 0xe45c10c42a2b3b06ULL,
+  0xaa242499697392d3ULL, 0xfd87b5f28300ca0eULL, 0xbce5086492111aebULL,
+  0x8cbccc096f5088ccULL, 0xd1b71758e219652cULL, 0x9c40000000000000ULL,
+  0xe8d4a51000000000ULL, 0xad78ebc5ac620000ULL, 0x813f3978f8940984ULL,
+  0xc097ce7bc90715b3ULL, 0x8f7e32ce7bea5c70ULL, 0xd5d238a4abe98068ULL,
+  0x9f4f2726179a2245ULL, 0xed63a231d4c4fb27ULL, 0xb0de65388cc8ada8ULL,
+  0x83c7088e1aab65dbULL, 0xc45d1df942711d9aULL, 0x924d692ca61be758ULL,
+  0xda01ee641a708deaULL, 0xa26da3999aef774aULL, 0xf209787bb47d6b85ULL,
+  0xb454e4a179dd1877ULL, 0x865b86925b9bc5c2ULL, 0xc83553c5c8965d3dULL,
+  0x952ab45cfa97a0b3ULL, 0xde469fbd99a05fe3ULL, 0xa59bc234db398c25ULL,
+  0xf6c69a72a3989f5cULL, 0xb7dcbf5354e9beceULL, 0x88fcf317f22241e2ULL,
+  0xcc20ce9bd35c78a5ULL, 0x98165af37b2153dfULL, 0xe2a0b5dc971f303aULL,
+  0xa8d9d1535ce3b396ULL, 0xfb9b7cd9a4a7443cULL, 0xbb764c4ca7a44410ULL,
+  0x8bab8eefb6409c1aULL, 0xd01fef10a657842cULL, 0x9b10a4e5e9913129ULL,
+  0xe7109bfba19c0c9dULL, 0xac2820d9623bf429ULL, 0x80444b5e7aa7cf85ULL,
+  0xbf21e44003acdd2dULL, 0x8e679c2f5e44ff8fULL, 0xd433179d9c8cb841ULL,
+  0x9e19db92b4e31ba9ULL, 0xeb96bf6ebadf77d9ULL, 0xaf87023b9bf0ee6bULL};
+static const int16_t grisu_pow_e[] = {
+  -1220, -1193, -1166, -1140, -1113, -1087, -1060, -1034, -1007, -980,
+  -954, -927, -901, -874, -847, -821, -794, -768, -741, -715,
+  -688, -661, -635, -608, -582, -555, -529, -502, -475, -449,
+  -422, -396, -369, -343, -316, -289, -263, -236, -210, -183,
+  -157, -130, -103, -77, -50, -24, 3, 30, 56, 83,
+  109, 136, 162, 189, 216, 242, 269, 295, 322, 348,
+  375, 402, 428, 455, 481, 508, 534, 561, 588, 614,
+  641, 667, 694, 720, 747, 774, 800, 827, 853, 880,
+  907, 933, 960, 986, 1013, 1039, 1066};
+
+//Two decimal digits for each value in 0 to 99.
+static const char digit_pairs[] =
+  "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+  "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+  "8081828384858687888990919293949596979899";
+
+static const uint64_t pow10_u64[] = {
+  1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL,
+  100000000ULL, 1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL,
+  10000000000000ULL, 100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+  100000000000000000ULL, 1000000000000000000ULL, 10000000000000000000ULL};
+
+//Writes the digits of x to buf and returns the number of digits.
+static int format_u64 (char* buf, uint64_t x){
+  int n = 1;
+  while(n < 20 && x >= pow10_u64[n]) n++;
+  char* p = buf + n;
+  while(x >= 100){
+    int i = (int)(x % 100) * 2;
+    x /= 100;
+    p -= 2;
+    p[0] = digit_pairs[i];
+    p[1] = digit_pairs[i + 1];
+  }
+  if(x >= 10){
+    p -= 2;
+    p[0] = digit_pairs[x * 2];
+    p[1] = digit_pairs[x * 2 + 1];
+  }
+  else{
+    *--p = (char)('0' + x);
+  }
+  return n;
+}
+
+//Writes x in decimal to buf, which must hold 20 bytes.
+//Returns the number of bytes written.
+int stz_format_long (char* buf, int64_t x){
+  if(x < 0){
+    buf[0] = '-';
+    return 1 + format_u64(buf + 1, 0 - (uint64_t)x);
+  }
+  return format_u64(buf, (uint64_t)x);
+}
+
+//Shortest round-trip digits of a double, following the Grisu2
+//algorithm of Loitsch, "Printing Floating-Point Numbers Quickly and
+//Accurately with Integers". A value is f * 2^e.
+typedef struct {
+  uint64_t f;
+  int e;
+} DiyFp;
+
+static DiyFp diyfp_mul (DiyFp x, DiyFp y){
+  uint64_t m32 = 0xFFFFFFFFULL;
+  uint64_t a = x.f >> 32, b = x.f & m32;
+  uint64_t c = y.f >> 32, d = y.f & m32;
+  uint64_t ac = a * c, bc = b * c, ad = a * d, bd = b * d;
+  uint64_t tmp = (bd >> 32) + (ad & m32) + (bc & m32) + (1ULL << 31);
+  DiyFp r = {ac + (ad >> 32) + (bc >> 32) + (tmp >> 32), x.e + y.e + 64};
+  return r;
+}
+
+static DiyFp diyfp_normalize (DiyFp x){
+  int s = __builtin_clzll(x.f);
+  DiyFp r = {x.f << s, x.e - s};
+  return r;
+}
+
+static void grisu_round (char* buf, int len, uint64_t delta, uint64_t rest,
+                         uint64_t ten_kappa, uint64_t wp_w){
+  while(rest < wp_w && delta - rest >= ten_kappa &&
+        (rest + ten_kappa < wp_w || wp_w - rest > rest + ten_kappa - wp_w)){
+    buf[len - 1]--;
+    rest += ten_kappa;
+  }
+}
+
+//Generates the digits of w into buf, which lie within delta of mp.
+static int grisu_digits (DiyFp w, DiyFp mp, uint64_t delta, char* buf, int* k){
+  DiyFp one = {1ULL << -mp.e, mp.e};
+  uint64_t wp_w = mp.f - w.f;
+  uint32_t p1 = (uint32_t)(mp.f >> -one.e);
+  uint64_t p2 = mp.f & (one.f - 1);
+  int kappa = 1;
+  while(kappa < 10 && p1 >= pow10_u64[kappa]) kappa++;
+  int len = 0;
+  while(kappa > 0){
+    uint32_t p = (uint32_t)pow10_u64[kappa - 1];
+    uint32_t d = p1 / p;
+    p1 %= p;
+    if(d || len) buf[len++] = (char)('0' + d);
+    kappa--;
+    uint64_t rest = ((uint64_t)p1 << -one.e) + p2;
+    if(rest <= delta){
+      *k += kappa;
+      grisu_round(buf, len, delta, rest, pow10_u64[kappa] << -one.e, wp_w);
+      return len;
+    }
+  }
+  while(1){
+    p2 *= 10;
+    delta *= 10;
+    char d = (char)(p2 >> -one.e);
+    if(d || len) buf[len++] = (char)('0' + d);
+    p2 &= one.f - 1;
+    kappa--;
+    if(p2 < delta){
+      *k += kappa;
+      grisu_round(buf, len, delta, p2, one.f, wp_w * pow10_u64[-kappa]);
+      return len;
+    }
+  }
+}
+
+//Writes the digits of the positive finite value x to buf, and returns
+//their number. The value is digits * 10^k.
+static int grisu2 (double x, char* buf, int* k){
+  uint64_t bits;
+  memcpy(&bits, &x, 8);
+  uint64_t hidden = 1ULL << 52;
+  int be = (int)((bits >> 52) & 0x7FF);
+  uint64_t f = bits & (hidden - 1);
+  DiyFp v;
+  if(be){ v.f = f + hidden; v.e = be - 1075; }
+  else{ v.f = f; v.e = -1074; }
+
+  //Boundaries halfway to the neighbouring doubles
+  DiyFp plus = {(v.f << 1) + 1, v.e - 1};
+  plus = diyfp_normalize(plus);
+  DiyFp minus;
+  if(v.f == hidden){ minus.f = (v.f << 2) - 1; minus.e = v.e - 2; }
+  else{ minus.f = (v.f << 1) - 1; minus.e = v.e - 1; }
+  minus.f <<= minus.e - plus.e;
+  minus.e = plus.e;
+
+  //Scale by a cached power of ten into the range of the digit loop
+  double dk = (-61 - plus.e) * 0.30102999566398114 + 347;
+  int ik = (int)dk;
+  if(dk - ik > 0.0) ik++;
+  int index = (ik >> 3) + 1;
+  *k = -(-348 + (index << 3));
+  DiyFp c = {grisu_pow_f[index], grisu_pow_e[index]};
+
+  DiyFp w = diyfp_mul(diyfp_normalize(v), c);
+  DiyFp wp = diyfp_mul(plus, c);
+  DiyFp wm = diyfp_mul(minus, c);
+  wm.f++;
+  wp.f--;
+  return grisu_digits(w, wp, wp.f - wm.f, buf, k);
+}
+
+//Writes x to buf as "%.6g" does, which must hold 32 bytes. A ".0" is
+//added when there is no fractional part. Returns the number of bytes
+//written.
+int stz_format_float (char* buf, double x){
+  int n = sprintf(buf, "%.6g", x);
+  int i = 0;
+  while(i < n && buf[i] != '.' && buf[i] != 'e') i++;
+  if(i < n && buf[i] == '.') return n;
+  memmove(buf + i + 2, buf + i, n - i);
+  buf[i] = '.';
+  buf[i + 1] = '0';
+  return n + 2;
+}
+
+//Writes x to buf in the shortest form that reads back as the same
+//double, which must hold 32 bytes. Values with a decimal exponent from
+//-4 up to 14 are written in positional notation, and others in
+//scientific notation, as with "%.15g". A ".0" is added when there is
+//no fractional part. Returns the number of bytes written.
+int stz_format_double (char* buf, double x){
+  if(!isfinite(x)){
+    int n = sprintf(buf, "%.15g", x);
+    buf[n] = '.';
+    buf[n + 1] = '0';
+    return n + 2;
+  }
+  char* p = buf;
+  if(signbit(x)){
+    *p++ = '-';
+    x = -x;
+  }
+  if(x == 0.0){
+    memcpy(p, "0.0", 3);
+    return (int)(p - buf) + 3;
+  }
+  char digits[20];
+  int k;
+  int len = grisu2(x, digits, &k);
+  int point = len + k;
+  int exponent = point - 1;
+  if(exponent >= -4 && exponent < 15){
+    if(point <= 0){
+      *p++ = '0';
+      *p++ = '.';
+      for(int i = point; i < 0; i++) *p++ = '0';
+      memcpy(p, digits, len);
+      p += len;
+    }
+    else if(point < len){
+      memcpy(p, digits, point);
+      p += point;
+      *p++ = '.';
+      memcpy(p, digits + point, len - point);
+      p += len - point;
+    }
+    else{
+      memcpy(p, digits, len);
+      p += len;
+      for(int i = len; i < point; i++) *p++ = '0';
+      *p++ = '.';
+      *p++ = '0';
+    }
+  }
+  else{
+    *p++ = digits[0];
+    *p++ = '.';
+    if(len > 1){
+      memcpy(p, digits + 1, len - 1);
+      p += len - 1;
+    }
+    else{
+      *p++ = '0';
+    }
+    *p++ = 'e';
+    if(exponent < 0){
+      *p++ = '-';
+      exponent = -exponent;
+    }
+    else{
+      *p++ = '+';
+    }
+    if(exponent < 10) *p++ = '0';
+    p += format_u64(p, (uint64_t)exponent);
+  }
+  return (int)(p - buf);
+}
+
+//============================================================
+//==================== Number Parsing ========================
+//============================================================
+
+//Returns the value of the digit c, or -1 if c is not a digit or letter.
+static int digit_value (char c){
+  if(c >= '0' && c <= '9') return c - '0';
+  if(c >= 'a' && c <= 'z') return c - 'a' + 10;
+  if(c >= 'A' && c <= 'Z') return c - 'A' + 10;
+  return -1;
+}
+
+//Parses the eight decimal digits at p in one go. Returns -1 if any
+//of them is not a digit.
+static int64_t parse_eight_digits (const char* p){
+  uint64_t v;
+  memcpy(&v, p, 8);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  v = __builtin_bswap64(v);
+#endif
+  if((v & 0xF0F0F0F0F0F0F0F0ULL) != 0x3030303030303030ULL ||
+     ((v + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) != 0x3030303030303030ULL)
+    return -1;
+  v -= 0x3030303030303030ULL;
+  v = v * 10 + (v >> 8);
+  v = ((v & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32)) +
+       ((v >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32))) >> 32;
+  return (int64_t)v;
+}
+
+//Parses the decimal digits in p[0 .. n) into a value that fits in
+//a signed integer of the given number of bits.
+static int parse_decimal (const char* p, int64_t n, int negative, int bits, int64_t* out){
+  uint64_t v = 0;
+  int64_t i = 0;
+  for(; n - i >= 8; i += 8){
+    int64_t d = parse_eight_digits(p + i);
+    if(d < 0) return 0;
+    if(v > (UINT64_MAX - (uint64_t)d) / 100000000) return 0;
+    v = v * 100000000 + (uint64_t)d;
+  }
+  for(; i < n; i++){
+    unsigned d = (unsigned char)p[i] - '0';
+    if(d > 9) return 0;
+    if(v > (UINT64_MAX - d) / 10) return 0;
+    v = v * 10 + d;
+  }
+  uint64_t limit = (uint64_t)1 << (bits - 1);
+  if(v > (negative ? limit : limit - 1)) return 0;
+  *out = negative ? (int64_t)(0 - v) : (int64_t)v;
+  return 1;
+}
+
+//Parses the digits in p[0 .. n), each holding shift bits, into a
+//value of the given number of bits. As with integer literals, the
+//top digit may overflow into the sign bit.
+static int parse_bits (const char* p, int64_t n, int shift, int bits, int64_t* out){
+  if(n * shift >= bits + shift) return 0;
+  uint64_t v = 0;
+  for(int64_t i = 0; i < n; i++){
+    int d = digit_value(p[i]);
+    if(d < 0 || d >= 1 << shift) return 0;
+    v = (v << shift) | (uint64_t)d;
+  }
+  *out = bits == 32 ? (int64_t)(int32_t)(uint32_t)v : (int64_t)v;
+  return 1;
+}
+
+//Parses p[0 .. n) as an integer of the given number of bits, in the
+//syntax of integer literals: decimal with an optional minus sign, or
+//binary, octal or hexadecimal with a 0b, 0o or 0x prefix.
+//Returns 1 and writes the value to out if successful.
+int stz_parse_integer (const char* p, int64_t n, int bits, int64_t* out){
+  if(n >= 1 && p[0] == '-')
+    return parse_decimal(p + 1, n - 1, 1, bits, out);
+  if(n >= 2 && p[0] == '0'){
+    switch(p[1]){
+    case 'b': return parse_bits(p + 2, n - 2, 1, bits, out);
+    case 'o': return parse_bits(p + 2, n - 2, 3, bits, out);
+    case 'x': return parse_bits(p + 2, n - 2, 4, bits, out);
+    }
+  }
+  return parse_decimal(p, n, 0, bits, out);
+}
+
+//Powers of five for Eisel-Lemire, 5^q for q = -342, ..., 308. Each is
+//the top 128 bits of the value, as a high and a low word, rounded up
+//for negative q.
+static const uint64_t powers_of_five[][2] = {
+  {0xeef453d6923bd65aULL, 0x113faa2906a13b3fULL},
+  {0x9558b4661b6565f8ULL, 0x4ac7ca59a424c507ULL},
+  {0xbaaee17fa23ebf76ULL, 0x5d79bcf00d2df649ULL},
+  {0xe95a99df8ace6f53ULL, 0xf4d82c2c107973dcULL},
+  {0x91d8a02bb6c10594ULL, 0x79071b9b8a4be869ULL},
+  {0xb64ec836a47146f9ULL, 0x9748e2826cdee284ULL},
+  {0xe3e27a444d8d98b7ULL, 0xfd1b1b2308169b25ULL},
+  {0x8e6d8c6ab0787f72ULL, 0xfe30f0f5e50e20f7ULL},
+  {0xb208ef855c969f4fULL, 0xbdbd2d335e51a935ULL},
+  {0xde8b2b66b3bc4723ULL, 0xad2c788035e61382ULL},
+  {0x8b16fb203055ac76ULL, 0x4c3bcb5021afcc31ULL},
+  {0xaddcb9e83c6b1793ULL, 0xdf4abe242a1bbf3dULL},
+  {0xd953e8624b85dd78ULL, 0xd71d6dad34a2af0dULL},
+  {0x87d4713d6f33aa6bULL, 0x8672648c40e5ad68ULL},
+  {0xa9c98d8ccb009506ULL, 0x680efdaf511f18c2ULL},
+  {0xd43bf0effdc0ba48ULL, 0x0212bd1b2566def2ULL},
+  {0x84a57695fe98746dULL, 0x014bb630f7604b57ULL},
+  {0xa5ced43b7e3e9188ULL, 0x419ea3bd35385e2dULL},
+  {0xcf42894a5dce35eaULL, 0x52064cac828675b9ULL},
+  {0x818995ce7aa0e1b2ULL, 0x7343efebd1940993ULL},
+  {0xa1ebfb4219491a1fULL, 0x1014ebe6c5f90bf8ULL},
+  {0xca66fa129f9b60a6ULL, 0xd41a26e077774ef6ULL},
+  {0xfd00b897478238d0ULL, 0x8920b098955522b4ULL},
+  {0x9e20735e8cb16382ULL, 0x55b46e5f5d5535b0ULL},
+  {0xc5a890362fddbc62ULL, 0xeb2189f734aa831dULL},
+  {0xf712b443bbd52b7bULL, 0xa5e9ec7501d523e4ULL},
+  {0x9a6bb0aa55653b2dULL, 0x47b233c92125366eULL},
+  {0xc1069cd4eabe89f8ULL, 0x999ec0bb696e840aULL},
+  {0xf148440a256e2c76ULL, 0xc00670ea43ca250dULL},
+  {0x96cd2a865764dbcaULL, 0x380406926a5e5728ULL},
+  {0xbc807527ed3e12bcULL, 0xc605083704f5ecf2ULL},
+  {0xeba09271e88d976bULL, 0xf7864a44c633682eULL},
+  {0x93445b8731587ea3ULL, 0x7ab3ee6afbe0211dULL},
+  {0xb8157268fdae9e4cULL, 0x5960ea05bad82964ULL},
+  {0xe61acf033d1a45dfULL, 0x6fb92487298e33bdULL},
+  {0x8fd0c16206306babULL, 0xa5d3b6d479f8e056ULL},
+  {0xb3c4f1ba87bc8696ULL, 0x8f48a4899877186cULL},
+  {0xe0b62e2929aba83cULL, 0x331acdabfe94de87ULL},
+  {0x8c71dcd9ba0b4925ULL, 0x9ff0c08b7f1d0b14ULL},
+  {0xaf8e5410288e1b6fULL, 0x07ecf0ae5ee44dd9ULL},
+  {0xdb71e91432b1a24aULL, 0xc9e82cd9f69d6150ULL},
+  {0x892731ac9faf056eULL, 0xbe311c083a225cd2ULL},
+  {0xab70fe17c79ac6caULL, 0x6dbd630a48aaf406ULL},
+  {0xd64d3d9db981787dULL, 0x092cbbccdad5b108ULL},
+  {0x85f0468293f0eb4eULL, 0x25bbf56008c58ea5ULL},
+  {0xa76c582338ed2621ULL, 0xaf2af2b80af6f24eULL},
+  {0xd1476e2c07286faaULL, 0x1af5af660db4aee1ULL},
+  {0x82cca4db847945caULL, 0x50d98d9fc890ed4dULL},
+  {0xa37fce126597973cULL, 0xe50ff107bab528a0ULL},
+  {0xcc5fc196fefd7d0cULL, 0x1e53ed49a96272c8ULL},
+  {0xff77b1fcbebcdc4fULL, 0x25e8e89c13bb0f7aULL},
+  {0x9faacf3df73609b1ULL, 0x77b191618c54e9acULL},
+  {0xc795830d75038c1dULL, 0xd59df5b9ef6a2417ULL},
+  {0xf97ae3d0d2446f25ULL, 0x4b0573286b44ad1dULL},
+  {0x9becce62836ac577ULL, 0x4ee367f9430aec32ULL},
+  {0xc2e801fb244576d5ULL, 0x229c41f793cda73fULL},
+  {0xf3a20279ed56d48aULL, 0x6b43527578c1110fULL},
+  {0x9845418c345644d6ULL, 0x830a13896b78aaa9ULL},
+  {0xbe5691ef416bd60cULL, 0x23cc986bc656d553ULL},
+  {0xedec366b11c6cb8fULL, 0x2cbfbe86b7ec8aa8ULL},
+  {0x94b3a202eb1c3f39ULL, 0x7bf7d71432f3d6a9ULL},
+  {0xb9e08a83a5e34f07ULL, 0xdaf5ccd93fb0cc53ULL},
+  {0xe858ad248f5c22c9ULL, 0xd1b3400f8f9cff68ULL},
+  {0x91376c36d99995beULL, 0x23100809b9c21fa1ULL},
+  {0xb58547448ffffb2dULL, 0xabd40a0c2832a78aULL},
+  {0xe2e69915b3fff9f9ULL, 0x16c90c8f323f516cULL},
+  {0x8dd01fad907ffc3bULL, 0xae3da7d97f6792e3ULL},
+  {0xb1442798f49ffb4aULL, 0x99cd11cfdf41779cULL},
+  {0xdd95317f31c7fa1dULL, 0x40405643d711d583ULL},
+  {0x8a7d3eef7f1cfc52ULL, 0x482835ea666b2572ULL},
+  {0xad1c8eab5ee43b66ULL, 0xda3243650005eecfULL},
+  {0xd863b256369d4a40ULL, 0x90bed43e40076a82ULL},
+  {0x873e4f75e2224e68ULL, 0x5a7744a6e804a291ULL},
+  {0xa90de3535aaae202ULL, 0x711515d0a205cb36ULL},
+  {0xd3515c2831559a83ULL, 0x0d5a5b44ca873e03ULL},
+  {0x8412d9991ed58091ULL, 0xe858790afe9486c2ULL},
+  {0xa5178fff668ae0b6ULL, 0x626e974dbe39a872ULL},
+  {0xce5d73ff402d98e3ULL, 0xfb0a3d212dc8128fULL},
+  {0x80fa687f881c7f8eULL, 0x7ce66634bc9d0b99ULL},
+  {0xa139029f6a239f72ULL, 0x1c1fffc1ebc44e80ULL},
+  {0xc987434744ac874eULL, 0xa327ffb266b56220ULL},
+  {0xfbe9141915d7a922ULL, 0x4bf1ff9f0062baa8ULL},
+  {0x9d71ac8fada6c9b5ULL, 0x6f773fc3603db4a9ULL},
+  {0xc4ce17b399107c22ULL, 0xcb550fb4384d21d3ULL},
+  {0xf6019da07f549b2bULL, 0x7e2a53a146606a48ULL},
+  {0x99c102844f94e0fbULL, 0x2eda7444cbfc426dULL},
+  {0xc0314325637a1939ULL, 0xfa911155fefb5308ULL},
+  {0xf03d93eebc589f88ULL, 0x793555ab7eba27caULL},
+  {0x96267c7535b763b5ULL, 0x4bc1558b2f3458deULL},
+  {0xbbb01b9283253ca2ULL, 0x9eb1aaedfb016f16ULL},
+  {0xea9c227723ee8bcbULL, 0x465e15a979c1cadcULL},
+  {0x92a1958a7675175fULL, 0x0bfacd89ec191ec9ULL},
+  {0xb749faed14125d36ULL, 0xcef980ec671f667bULL},
+  {0xe51c79a85916f484ULL, 0x82b7e12780e7401aULL},
+  {0x8f31cc0937ae58d2ULL, 0xd1b2ecb8b0908810ULL},
+  {0xb2fe3f0b8599ef07ULL, 0x861fa7e6dcb4aa15ULL},
+  {0xdfbdcece67006ac9ULL, 0x67a791e093e1d49aULL},
+  {0x8bd6a141006042bdULL, 0xe0c8bb2c5c6d24e0ULL},
+  {0xaecc49914078536dULL, 0x58fae9f773886e18ULL},
+  {0xda7f5bf590966848ULL, 0xaf39a475506a899eULL},
+  {0x888f99797a5e012dULL, 0x6d8406c952429603ULL},
+  {0xaab37fd7d8f58178ULL, 0xc8e5087ba6d33b83ULL},
+  {0xd5605fcdcf32e1d6ULL, 0xfb1e4a9a90880a64ULL},
+  {0x855c3be0a17fcd26ULL, 0x5cf2eea09a55067fULL},
+  {0xa6b34ad8c9dfc06fULL, 0xf42faa48c0ea481eULL},
+  {0xd0601d8efc57b08bULL, 0xf13b94daf124da26ULL},
+  {0x823c12795db6ce57ULL, 0x76c53d08d6b70858ULL},
+  {0xa2cb1717b52481edULL, 0x54768c4b0c64ca6eULL},
+  {0xcb7ddcdda26da268ULL, 0xa9942f5dcf7dfd09ULL},
+  {0xfe5d54150b090b02ULL, 0xd3f93b35435d7c4cULL},
+  {0x9efa548d26e5a6e1ULL, 0xc47bc5014a1a6dafULL},
+  {0xc6b8e9b0709f109aULL, 0x359ab6419ca1091bULL},
+  {0xf867241c8cc6d4c0ULL, 0xc30163d203c94b62ULL},
+  {0x9b407691d7fc44f8ULL, 0x79e0de63425dcf1dULL},
+  {0xc21094364dfb5636ULL, 0x985915fc12f542e4ULL},
+  {0xf294b943e17a2bc4ULL, 0x3e6f5b7b17b2939dULL},
+  {0x979cf3ca6cec5b5aULL, 0xa705992ceecf9c42ULL},
+  {0xbd8430bd08277231ULL, 0x50c6ff782a838353ULL},
+  {0xece53cec4a314ebdULL, 0xa4f8bf5635246428ULL},
+  {0x940f4613ae5ed136ULL, 0x871b7795e136be99ULL},
+  {0xb913179899f68584ULL, 0x28e2557b59846e3fULL},
+  {0xe757dd7ec07426e5ULL, 0x331aeada2fe589cfULL},
+  {0x9096ea6f3848984fULL, 0x3ff0d2c85def7621ULL},
+  {0xb4bca50b065abe63ULL, 0x0fed077a756b53a9ULL},
+  {0xe1ebce4dc7f16dfbULL, 0xd3e8495912c62894ULL},
+  {0x8d3360f09cf6e4bdULL, 0x64712dd7abbbd95cULL},
+  {0xb080392cc4349decULL, 0xbd8d794d96aacfb3ULL},
+  {0xdca04777f541c567ULL, 0xecf0d7a0fc5583a0ULL},
+  {0x89e42caaf9491b60ULL, 0xf41686c49db57244ULL},
+  {0xac5d37d5b79b6239ULL, 0x311c2875c522ced5ULL},
+  {0xd77485cb25823ac7ULL, 0x7d633293366b828bULL},
+  {0x86a8d39ef77164bcULL, 0xae5dff9c02033197ULL},
+  {0xa8530886b54dbdebULL, 0xd9f57f830283fdfcULL},
+  {0xd267caa862a12d66ULL, 0xd072df63c324fd7bULL},
+  {0x8380dea93da4bc60ULL, 0x4247cb9e59f71e6dULL},
+  {0xa46116538d0deb78ULL, 0x52d9be85f074e608ULL},
+  {0xcd795be870516656ULL, 0x67902e276c921f8bULL},
+  {0x806bd9714632dff6ULL, 0x00ba1cd8a3db53b6ULL},
+  {0xa086cfcd97bf97f3ULL, 0x80e8a40eccd228a4ULL},
+  {0xc8a883c0fdaf7df0ULL, 0x6122cd128006b2cdULL},
+  {0xfad2a4b13d1b5d6cULL, 0x796b805720085f81ULL},
+  {0x9cc3a6eec6311a63ULL, 0xcbe3303674053bb0ULL},
+  {0xc3f490aa77bd60fcULL, 0xbedbfc4411068a9cULL},
+  {0xf4f1b4d515acb93bULL, 0xee92fb5515482d44ULL},
+  {0x991711052d8bf3c5ULL, 0x751bdd152d4d1c4aULL},
+  {0xbf5cd54678eef0b6ULL, 0xd262d45a78a0635dULL},
+  {0xef340a98172aace4ULL, 0x86fb897116c87c34ULL},
+  {0x9580869f0e7aac0eULL, 0xd45d35e6ae3d4da0ULL},
+  {0xbae0a846d2195712ULL, 0x8974836059cca109ULL},
+  {0xe998d258869facd7ULL, 0x2bd1a438703fc94bULL},
+  {0x91ff83775423cc06ULL, 0x7b6306a34627ddcfULL},
+  {0xb67f6455292cbf08ULL, 0x1a3bc84c17b1d542ULL},
+  {0xe41f3d6a7377eecaULL, 0x20caba5f1d9e4a93ULL},
+  {0x8e938662882af53eULL, 0x547eb47b7282ee9cULL},
+  {0xb23867fb2a35b28dULL, 0xe99e619a4f23aa43ULL},
+  {0xdec681f9f4c31f31ULL, 0x6405fa00e2ec94d4ULL},
+  {0x8b3c113c38f9f37eULL, 0xde83bc408dd3dd04ULL},
+  {0xae0b158b4738705eULL, 0x9624ab50b148d445ULL},
+  {0xd98ddaee19068c76ULL, 0x3badd624dd9b0957ULL},
+  {0x87f8a8d4cfa417c9ULL, 0xe54ca5d70a80e5d6ULL},
+  {0xa9f6d30a038d1dbcULL, 0x5e9fcf4ccd211f4cULL},
+  {0xd47487cc8470652bULL, 0x7647c3200069671fULL},
+  {0x84c8d4dfd2c63f3bULL, 0x29ecd9f40041e073ULL},
+  {0xa5fb0a17c777cf09ULL, 0xf468107100525890ULL},
+  {0xcf79cc9db955c2ccULL, 0x7182148d4066eeb4ULL},
+  {0x81ac1fe293d599bfULL, 0xc6f14cd848405530ULL},
+  {0xa21727db38cb002fULL, 0xb8ada00e5a506a7cULL},
+  {0xca9cf1d206fdc03bULL, 0xa6d90811f0e4851cULL},
+  {0xfd442e4688bd304aULL, 0x908f4a166d1da663ULL},
+  {0x9e4a9cec15763e2eULL, 0x9a598e4e043287feULL},
+  {0xc5dd44271ad3cdbaULL, 0x40eff1e1853f29fdULL},
+  {0xf7549530e188c128ULL, 0xd12bee59e68ef47cULL},
+  {0x9a94dd3e8cf578b9ULL, 0x82bb74f8301958ceULL},
+  {0xc13a148e3032d6e7ULL, 0xe36a52363c1faf01ULL},
+  {0xf18899b1bc3f8ca1ULL, 0xdc44e6c3cb279ac1ULL},
+  {0x96f5600f15a7b7e5ULL, 0x29ab103a5ef8c0b9ULL},
+  {0xbcb2b812db11a5deULL, 0x7415d448f6b6f0e7ULL},
+  {0xebdf661791d60f56ULL, 0x111b495b3464ad21ULL},
+  {0x936b9fcebb25c995ULL, 0xcab10dd900beec34ULL},
+  {0xb84687c269ef3bfbULL, 0x3d5d514f40eea742ULL},
+  {0xe65829b3046b0afaULL, 0x0cb4a5a3112a5112ULL},
+  {0x8ff71a0fe2c2e6dcULL, 0x47f0e785eaba72abULL},
+  {0xb3f4e093db73a093ULL, 0x59ed216765690f56ULL},
+  {0xe0f218b8d25088b8ULL, 0x306869c13ec3532cULL},
+  {0x8c974f7383725573ULL, 0x1e414218c73a13fbULL},
+  {0xafbd2350644eeacfULL, 0xe5d1929ef90898faULL},
+  {0xdbac6c247d62a583ULL, 0xdf45f746b74abf39ULL},
+  {0x894bc396ce5da772ULL, 0x6b8bba8c328eb783ULL},
+  {0xab9eb47c81f5114fULL, 0x066ea92f3f326564ULL},
+  {0xd686619ba27255a2ULL, 0xc80a537b0efefebdULL},
+  {0x8613fd0145877585ULL, 0xbd06742ce95f5f36ULL},
+  {0xa798fc4196e952e7ULL, 0x2c48113823b73704ULL},
+  {0xd17f3b51fca3a7a0ULL, 0xf75a15862ca504c5ULL},
+  {0x82ef85133de648c4ULL, 0x9a984d73dbe722fbULL},
+  {0xa3ab66580d5fdaf5ULL, 0xc13e60d0d2e0ebbaULL},
+  {0xcc963fee10b7d1b3ULL, 0x318df905079926a8ULL},
+  {0xffbbcfe994e5c61fULL, 0xfdf17746497f7052ULL},
+  {0x9fd561f1fd0f9bd3ULL, 0xfeb6ea8bedefa633ULL},
+  {0xc7caba6e7c5382c8ULL, 0xfe64a52ee96b8fc0ULL},
+  {0xf9bd690a1b68637bULL, 0x3dfdce7aa3c673b0ULL},
+  {0x9c1661a651213e2dULL, 0x06bea10ca65c084eULL},
+  {0xc31bfa0fe5698db8ULL, 0x486e494fcff30a62ULL},
+  {0xf3e2f893dec3f126ULL, 0x5a89dba3c3efccfaULL},
+  {0x986ddb5c6b3a76b7ULL, 0xf89629465a75e01cULL},
+  {0xbe89523386091465ULL, 0xf6bbb397f1135823ULL},
+  {0xee2ba6c0678b597fULL, 0x746aa07ded582e2cULL},
+  {0x94db483840b717efULL, 0xa8c2a44eb4571cdcULL},
+  {0xba121a4650e4ddebULL, 0x92f34d62616ce413ULL},
+  {0xe896a0d7e51e1566ULL, 0x77b020baf9c81d17ULL},
+  {0x915e2486ef32cd60ULL, 0x0ace1474dc1d122eULL},
+  {0xb5b5ada8aaff80b8ULL, 0x0d819992132456baULL},
+  {0xe3231912d5bf60e6ULL, 0x10e1fff697ed6c69ULL},
+  {0x8df5efabc5979c8fULL, 0xca8d3ffa1ef463c1ULL},
+  {0xb1736b96b6fd83b3ULL, 0xbd308ff8a6b17cb2ULL},
+  {0xddd0467c64bce4a0ULL, 0xac7cb3f6d05ddbdeULL},
+  {0x8aa22c0dbef60ee4ULL, 0x6bcdf07a423aa96bULL},
+  {0xad4ab7112eb3929dULL, 0x86c16c98d2c953c6ULL},
+  {0xd89d64d57a607744ULL, 0xe871c7bf077ba8b7ULL},
+  {0x87625f056c7c4a8bULL, 0x11471cd764ad4972ULL},
+  {0xa93af6c6c79b5d2dULL, 0xd598e40d3dd89bcfULL},
+  {0xd389b47879823479ULL, 0x4aff1d108d4ec2c3ULL},
+  {0x843610cb4bf160cbULL, 0xcedf722a585139baULL},
+  {0xa54394fe1eedb8feULL, 0xc2974eb4ee658828ULL},
+  {0xce947a3da6a9273eULL, 0x733d226229feea32ULL},
+  {0x811ccc668829b887ULL, 0x0806357d5a3f525fULL},
+  {0xa163ff802a3426a8ULL, 0xca07c2dcb0cf26f7ULL},
+  {0xc9bcff6034c13052ULL, 0xfc89b393dd02f0b5ULL},
+  {0xfc2c3f3841f17c67ULL, 0xbbac2078d443ace2ULL},
+  {0x9d9ba7832936edc0ULL, 0xd54b944b84aa4c0dULL},
+  {0xc5029163f384a931ULL, 0x0a9e795e65d4df11ULL},
+  {0xf64335bcf065d37dULL, 0x4d4617b5ff4a16d5ULL},
+  {0x99ea0196163fa42eULL, 0x504bced1bf8e4e45ULL},
+  {0xc06481fb9bcf8d39ULL, 0xe45ec2862f71e1d6ULL},
+  {0xf07da27a82c37088ULL, 0x5d767327bb4e5a4cULL},
+  {0x964e858c91ba2655ULL, 0x3a6a07f8d510f86fULL},
+  {0xbbe226efb628afeaULL, 0x890489f70a55368bULL},
+  {0xeadab0aba3b2dbe5ULL, 0x2b45ac74ccea842eULL},
+  {0x92c8ae6b464fc96fULL, 0x3b0b8bc90012929dULL},
+  {0xb77ada0617e3bbcbULL, 0x09ce6ebb40173744ULL},
+  {0xe55990879ddcaabdULL, 0xcc420a6a101d0515ULL},
+  {0x8f57fa54c2a9eab6ULL, 0x9fa946824a12232dULL},
+  {0xb32df8e9f3546564ULL, 0x47939822dc96abf9ULL},
+  {0xdff9772470297ebdULL, 0x59787e2b93bc56f7ULL},
+  {0x8bfbea76c619ef36ULL, 0x57eb4edb3c55b65aULL},
+  {0xaefae51477a06b03ULL, 0xede622920b6b23f1ULL},
+  {0xdab99e59958885c4ULL, 0xe95fab368e45ecedULL},
+  {0x88b402f7fd75539bULL, 0x11dbcb0218ebb414ULL},
+  {0xaae103b5fcd2a881ULL, 0xd652bdc29f26a119ULL},
+  {0xd59944a37c0752a2ULL, 0x4be76d3346f0495fULL},
+  {0x857fcae62d8493a5ULL, 0x6f70a4400c562ddbULL},
+  {0xa6dfbd9fb8e5b88eULL, 0xcb4ccd500f6bb952ULL},
+  {0xd097ad07a71f26b2ULL, 0x7e2000a41346a7a7ULL},
+  {0x825ecc24c873782fULL, 0x8ed400668c0c28c8ULL},
+  {0xa2f67f2dfa90563bULL, 0x728900802f0f32faULL},
+  {0xcbb41ef979346bcaULL, 0x4f2b40a03ad2ffb9ULL},
+  {0xfea126b7d78186bcULL, 0xe2f610c84987bfa8ULL},
+  {0x9f24b832e6b0f436ULL, 0x0dd9ca7d2df4d7c9ULL},
+  {0xc6ede63fa05d3143ULL, 0x91503d1c79720dbbULL},
+  {0xf8a95fcf88747d94ULL, 0x75a44c6397ce912aULL},
+  {0x9b69dbe1b548ce7cULL, 0xc986afbe3ee11abaULL},
+  {0xc24452da229b021bULL, 0xfbe85badce996168ULL},
+  {0xf2d56790ab41c2a2ULL, 0xfae27299423fb9c3ULL},
+  {0x97c560ba6b0919a5ULL, 0xdccd879fc967d41aULL},
+  {0xbdb6b8e905cb600fULL, 0x5400e987bbc1c920ULL},
+  {0xed246723473e3813ULL, 0x290123e9aab23b68ULL},
+  {0x9436c0760c86e30bULL, 0xf9a0b6720aaf6521ULL},
+  {0xb94470938fa89bceULL, 0xf808e40e8d5b3e69ULL},
+  {0xe7958cb87392c2c2ULL, 0xb60b1d1230b20e04ULL},
+  {0x90bd77f3483bb9b9ULL, 0xb1c6f22b5e6f48c2ULL},
+  {0xb4ecd5f01a4aa828ULL, 0x1e38aeb6360b1af3ULL},
+  {0xe2280b6c20dd5232ULL, 0x25c6da63c38de1b0ULL},
+  {0x8d590723948a535fULL, 0x579c487e5a38ad0eULL},
+  {0xb0af48ec79ace837ULL, 0x2d835a9df0c6d851ULL},
+  {0xdcdb1b2798182244ULL, 0xf8e431456cf88e65ULL},
+  {0x8a08f0f8bf0f156bULL, 0x1b8e9ecb641b58ffULL},
+  {0xac8b2d36eed2dac5ULL, 0xe272467e3d222f3fULL},
+  {0xd7adf884aa879177ULL, 0x5b0ed81dcc6abb0fULL},
+  {0x86ccbb52ea94baeaULL, 0x98e947129fc2b4e9ULL},
+  {0xa87fea27a539e9a5ULL, 0x3f2398d747b36224ULL},
+  {0xd29fe4b18e88640eULL, 0x8eec7f0d19a03aadULL},
+  {0x83a3eeeef9153e89ULL, 0x1953cf68300424acULL},
+  {0xa48ceaaab75a8e2bULL, 0x5fa8c3423c052dd7ULL},
+  {0xcdb02555653131b6ULL, 0x3792f412cb06794dULL},
+  {0x808e17555f3ebf11ULL, 0xe2bbd88bbee40bd0ULL},
+  {0xa0b19d2ab70e6ed6ULL, 0x5b6aceaeae9d0ec4ULL},
+  {0xc8de047564d20a8bULL, 0xf245825a5a445275ULL},
+  {0xfb158592be068d2eULL, 0xeed6e2f0f0d56712ULL},
+  {0x9ced737bb6c4183dULL, 0x55464dd69685606bULL},
+  {0xc428d05aa4751e4cULL, 0xaa97e14c3c26b886ULL},
+  {0xf53304714d9265dfULL, 0xd53dd99f4b3066a8ULL},
+  {0x993fe2c6d07b7fabULL, 0xe546a8038efe4029ULL},
+  {0xbf8fdb78849a5f96ULL, 0xde98520472bdd033ULL},
+  {0xef73d256a5c0f77cULL, 0x963e66858f6d4440ULL},
+  {0x95a8637627989aadULL, 0xdde7001379a44aa8ULL},
+  {0xbb127c53b17ec159ULL, 0x5560c018580d5d52ULL},
+  {0xe9d71b689dde71afULL, 0xaab8f01e6e10b4a6ULL},
+  {0x9226712162ab070dULL, 0xcab3961304ca70e8ULL},
+  {0xb6b00d69bb55c8d1ULL, 0x3d607b97c5fd0d22ULL},
+  {0xe45c10c42a2b3b05ULL, 0x8cb89a7db77c506aULL},
+  {0x8eb98a7a9a5b04e3ULL, 0x77f3608e92adb242ULL},
+  {0xb267ed1940f1c61cULL, 0x55f038b237591ed3ULL},
+  {0xdf01e85f912e37a3ULL, 0x6b6c46dec52f6688ULL},
+  {0x8b61313bbabce2c6ULL, 0x2323ac4b3b3da015ULL},
+  {0xae397d8aa96c1b77ULL, 0xabec975e0a0d081aULL},
+  {0xd9c7dced53c72255ULL, 0x96e7bd358c904a21ULL},
+  {0x881cea14545c7575ULL, 0x7e50d64177da2e54ULL},
+  {0xaa242499697392d2ULL, 0xdde50bd1d5d0b9e9ULL},
+  {0xd4ad2dbfc3d07787ULL, 0x955e4ec64b44e864ULL},
+  {0x84ec3c97da624ab4ULL, 0xbd5af13bef0b113eULL},
+  {0xa6274bbdd0fadd61ULL, 0xecb1ad8aeacdd58eULL},
+  {0xcfb11ead453994baULL, 0x67de18eda5814af2ULL},
+  {0x81ceb32c4b43fcf4ULL, 0x80eacf948770ced7ULL},
+  {0xa2425ff75e14fc31ULL, 0xa1258379a94d028dULL},
+  {0xcad2f7f5359a3b3eULL, 0x096ee45813a04330ULL},
+  {0xfd87b5f28300ca0dULL, 0x8bca9d6e188853fcULL},
+  {0x9e74d1b791e07e48ULL, 0x775ea264cf55347eULL},
+  {0xc612062576589ddaULL, 0x95364afe032a819eULL},
+  {0xf79687aed3eec551ULL, 0x3a83ddbd83f52205ULL},
+  {0x9abe14cd44753b52ULL, 0xc4926a9672793543ULL},
+  {0xc16d9a0095928a27ULL, 0x75b7053c0f178294ULL},
+  {0xf1c90080baf72cb1ULL, 0x5324c68b12dd6339ULL},
+  {0x971da05074da7beeULL, 0xd3f6fc16ebca5e04ULL},
+  {0xbce5086492111aeaULL, 0x88f4bb1ca6bcf585ULL},
+  {0xec1e4a7db69561a5ULL, 0x2b31e9e3d06c32e6ULL},
+  {0x9392ee8e921d5d07ULL, 0x3aff322e62439fd0ULL},
+  {0xb877aa3236a4b449ULL, 0x09befeb9fad487c3ULL},
+  {0xe69594bec44de15bULL, 0x4c2ebe687989a9b4ULL},
+  {0x901d7cf73ab0acd9ULL, 0x0f9d37014bf60a11ULL},
+  {0xb424dc35095cd80fULL, 0x538484c19ef38c95ULL},
+  {0xe12e13424bb40e13ULL, 0x2865a5f206b06fbaULL},
+  {0x8cbccc096f5088cbULL, 0xf93f87b7442e45d4ULL},
+  {0xafebff0bcb24aafeULL, 0xf78f69a51539d749ULL},
+  {0xdbe6fecebdedd5beULL, 0xb573440e5a884d1cULL},
+  {0x89705f4136b4a597ULL, 0x31680a88f8953031ULL},
+  {0xabcc77118461cefcULL, 0xfdc20d2b36ba7c3eULL},
+  {0xd6bf94d5e57a42bcULL, 0x3d32907604691b4dULL},
+  {0x8637bd05af6c69b5ULL, 0xa63f9a49c2c1b110ULL},
+  {0xa7c5ac471b478423ULL, 0x0fcf80dc33721d54ULL},
+  {0xd1b71758e219652bULL, 0xd3c36113404ea4a9ULL},
+  {0x83126e978d4fdf3bULL, 0x645a1cac083126eaULL},
+  {0xa3d70a3d70a3d70aULL, 0x3d70a3d70a3d70a4ULL},
+  {0xccccccccccccccccULL, 0xcccccccccccccccdULL},
+  {0x8000000000000000ULL, 0x0000000000000000ULL},
+  {0xa000000000000000ULL, 0x0000000000000000ULL},
+  {0xc800000000000000ULL, 0x0000000000000000ULL},
+  {0xfa00000000000000ULL, 0x0000000000000000ULL},
+  {0x9c40000000000000ULL, 0x0000000000000000ULL},
+  {0xc350000000000000ULL, 0x0000000000000000ULL},
+  {0xf424000000000000ULL, 0x0000000000000000ULL},
+  {0x9896800000000000ULL, 0x0000000000000000ULL},
+  {0xbebc200000000000ULL, 0x0000000000000000ULL},
+  {0xee6b280000000000ULL, 0x0000000000000000ULL},
+  {0x9502f90000000000ULL, 0x0000000000000000ULL},
+  {0xba43b74000000000ULL, 0x0000000000000000ULL},
+  {0xe8d4a51000000000ULL, 0x0000000000000000ULL},
+  {0x9184e72a00000000ULL, 0x0000000000000000ULL},
+  {0xb5e620f480000000ULL, 0x0000000000000000ULL},
+  {0xe35fa931a0000000ULL, 0x0000000000000000ULL},
+  {0x8e1bc9bf04000000ULL, 0x0000000000000000ULL},
+  {0xb1a2bc2ec5000000ULL, 0x0000000000000000ULL},
+  {0xde0b6b3a76400000ULL, 0x0000000000000000ULL},
+  {0x8ac7230489e80000ULL, 0x0000000000000000ULL},
+  {0xad78ebc5ac620000ULL, 0x0000000000000000ULL},
+  {0xd8d726b7177a8000ULL, 0x0000000000000000ULL},
+  {0x878678326eac9000ULL, 0x0000000000000000ULL},
+  {0xa968163f0a57b400ULL, 0x0000000000000000ULL},
+  {0xd3c21bcecceda100ULL, 0x0000000000000000ULL},
+  {0x84595161401484a0ULL, 0x0000000000000000ULL},
+  {0xa56fa5b99019a5c8ULL, 0x0000000000000000ULL},
+  {0xcecb8f27f4200f3aULL, 0x0000000000000000ULL},
+  {0x813f3978f8940984ULL, 0x4000000000000000ULL},
+  {0xa18f07d736b90be5ULL, 0x5000000000000000ULL},
+  {0xc9f2c9cd04674edeULL, 0xa400000000000000ULL},
+  {0xfc6f7c4045812296ULL, 0x4d00000000000000ULL},
+  {0x9dc5ada82b70b59dULL, 0xf020000000000000ULL},
+  {0xc5371912364ce305ULL, 0x6c28000000000000ULL},
+  {0xf684df56c3e01bc6ULL, 0xc732000000000000ULL},
+  {0x9a130b963a6c115cULL, 0x3c7f400000000000ULL},
+  {0xc097ce7bc90715b3ULL, 0x4b9f100000000000ULL},
+  {0xf0bdc21abb48db20ULL, 0x1e86d40000000000ULL},
+  {0x96769950b50d88f4ULL, 0x1314448000000000ULL},
+  {0xbc143fa4e250eb31ULL, 0x17d955a000000000ULL},
+  {0xeb194f8e1ae525fdULL, 0x5dcfab0800000000ULL},
+  {0x92efd1b8d0cf37beULL, 0x5aa1cae500000000ULL},
+  {0xb7abc627050305adULL, 0xf14a3d9e40000000ULL},
+  {0xe596b7b0c643c719ULL, 0x6d9ccd05d0000000ULL},
+  {0x8f7e32ce7bea5c6fULL, 0xe4820023a2000000ULL},
+  {0xb35dbf821ae4f38bULL, 0xdda2802c8a800000ULL},
+  {0xe0352f62a19e306eULL, 0xd50b2037ad200000ULL},
+  {0x8c213d9da502de45ULL, 0x4526f422cc340000ULL},
+  {0xaf298d050e4395d6ULL, 0x9670b12b7f410000ULL},
+  {0xdaf3f04651d47b4cULL, 0x3c0cdd765f114000ULL},
+  {0x88d8762bf324cd0fULL, 0xa5880a69fb6ac800ULL},
+  {0xab0e93b6efee0053ULL, 0x8eea0d047a457a00ULL},
+  {0xd5d238a4abe98068ULL, 0x72a4904598d6d880ULL},
+  {0x85a36366eb71f041ULL, 0x47a6da2b7f864750ULL},
+  {0xa70c3c40a64e6c51ULL, 0x999090b65f67d924ULL},
+  {0xd0cf4b50cfe20765ULL, 0xfff4b4e3f741cf6dULL},
+  {0x82818f1281ed449fULL, 0xbff8f10e7a8921a4ULL},
+  {0xa321f2d7226895c7ULL, 0xaff72d52192b6a0dULL},
+  {0xcbea6f8ceb02bb39ULL, 0x9bf4f8a69f764490ULL},
+  {0xfee50b7025c36a08ULL, 0x02f236d04753d5b4ULL},
+  {0x9f4f2726179a2245ULL, 0x01d762422c946590ULL},
+  {0xc722f0ef9d80aad6ULL, 0x424d3ad2b7b97ef5ULL},
+  {0xf8ebad2b84e0d58bULL, 0xd2e0898765a7deb2ULL},
+  {0x9b934c3b330c8577ULL, 0x63cc55f49f88eb2fULL},
+  {0xc2781f49ffcfa6d5ULL, 0x3cbf6b71c76b25fbULL},
+  {0xf316271c7fc3908aULL, 0x8bef464e3945ef7aULL},
+  {0x97edd871cfda3a56ULL, 0x97758bf0e3cbb5acULL},
+  {0xbde94e8e43d0c8ecULL, 0x3d52eeed1cbea317ULL},
+  {0xed63a231d4c4fb27ULL, 0x4ca7aaa863ee4bddULL},
+  {0x945e455f24fb1cf8ULL, 0x8fe8caa93e74ef6aULL},
+  {0xb975d6b6ee39e436ULL, 0xb3e2fd538e122b44ULL},
+  {0xe7d34c64a9c85d44ULL, 0x60dbbca87196b616ULL},
+  {0x90e40fbeea1d3a4aULL, 0xbc8955e946fe31cdULL},
+  {0xb51d13aea4a488ddULL, 0x6babab6398bdbe41ULL},
+  {0xe264589a4dcdab14ULL, 0xc696963c7eed2dd1ULL},
+  {0x8d7eb76070a08aecULL, 0xfc1e1de5cf543ca2ULL},
+  {0xb0de65388cc8ada8ULL, 0x3b25a55f43294bcbULL},
+  {0xdd15fe86affad912ULL, 0x49ef0eb713f39ebeULL},
+  {0x8a2dbf142dfcc7abULL, 0x6e3569326c784337ULL},
+  {0xacb92ed9397bf996ULL, 0x49c2c37f07965404ULL},
+  {0xd7e77a8f87daf7fbULL, 0xdc33745ec97be906ULL},
+  {0x86f0ac99b4e8dafdULL, 0x69a028bb3ded71a3ULL},
+  {0xa8acd7c0222311bcULL, 0xc40832ea0d68ce0cULL},
+  {0xd2d80db02aabd62bULL, 0xf50a3fa490c30190ULL},
+  {0x83c7088e1aab65dbULL, 0x792667c6da79e0faULL},
+  {0xa4b8cab1a1563f52ULL, 0x577001b891185938ULL},
+  {0xcde6fd5e09abcf26ULL, 0xed4c0226b55e6f86ULL},
+  {0x80b05e5ac60b6178ULL, 0x544f8158315b05b4ULL},
+  {0xa0dc75f1778e39d6ULL, 0x696361ae3db1c721ULL},
+  {0xc913936dd571c84cULL, 0x03bc3a19cd1e38e9ULL},
+  {0xfb5878494ace3a5fULL, 0x04ab48a04065c723ULL},
+  {0x9d174b2dcec0e47bULL, 0x62eb0d64283f9c76ULL},
+  {0xc45d1df942711d9aULL, 0x3ba5d0bd324f8394ULL},
+  {0xf5746577930d6500ULL, 0xca8f44ec7ee36479ULL},
+  {0x9968bf6abbe85f20ULL, 0x7e998b13cf4e1ecbULL},
+  {0xbfc2ef456ae276e8ULL, 0x9e3fedd8c321a67eULL},
+  {0xefb3ab16c59b14a2ULL, 0xc5cfe94ef3ea101eULL},
+  {0x95d04aee3b80ece5ULL, 0xbba1f1d158724a12ULL},
+  {0xbb445da9ca61281fULL, 0x2a8a6e45ae8edc97ULL},
+  {0xea1575143cf97226ULL, 0xf52d09d71a3293bdULL},
+  {0x924d692ca61be758ULL, 0x593c2626705f9c56ULL},
+  {0xb6e0c377cfa2e12eULL, 0x6f8b2fb00c77836cULL},
+  {0xe498f455c38b997aULL, 0x0b6dfb9c0f956447ULL},
+  {0x8edf98b59a373fecULL, 0x4724bd4189bd5eacULL},
+  {0xb2977ee300c50fe7ULL, 0x58edec91ec2cb657ULL},
+  {0xdf3d5e9bc0f653e1ULL, 0x2f2967b66737e3edULL},
+  {0x8b865b215899f46cULL, 0xbd79e0d20082ee74ULL},
+  {0xae67f1e9aec07187ULL, 0xecd8590680a3aa11ULL},
+  {0xda01ee641a708de9ULL, 0xe80e6f4820cc9495ULL},
+  {0x884134fe908658b2ULL, 0x3109058d147fdcddULL},
+  {0xaa51823e34a7eedeULL, 0xbd4b46f0599fd415ULL},
+  {0xd4e5e2cdc1d1ea96ULL, 0x6c9e18ac7007c91aULL},
+  {0x850fadc09923329eULL, 0x03e2cf6bc604ddb0ULL},
+  {0xa6539930bf6bff45ULL, 0x84db8346b786151cULL},
+  {0xcfe87f7cef46ff16ULL, 0xe612641865679a63ULL},
+  {0x81f14fae158c5f6eULL, 0x4fcb7e8f3f60c07eULL},
+  {0xa26da3999aef7749ULL, 0xe3be5e330f38f09dULL},
+  {0xcb090c8001ab551cULL, 0x5cadf5bfd3072cc5ULL},
+  {0xfdcb4fa002162a63ULL, 0x73d9732fc7c8f7f6ULL},
+  {0x9e9f11c4014dda7eULL, 0x2867e7fddcdd9afaULL},
+  {0xc646d63501a1511dULL, 0xb281e1fd541501b8ULL},
+  {0xf7d88bc24209a565ULL, 0x1f225a7ca91a4226ULL},
+  {0x9ae757596946075fULL, 0x3375788de9b06958ULL},
+  {0xc1a12d2fc3978937ULL, 0x0052d6b1641c83aeULL},
+  {0xf209787bb47d6b84ULL, 0xc0678c5dbd23a49aULL},
+  {0x9745eb4d50ce6332ULL, 0xf840b7ba963646e0ULL},
+  {0xbd176620a501fbffULL, 0xb650e5a93bc3d898ULL},
+  {0xec5d3fa8ce427affULL, 0xa3e51f138ab4cebeULL},
+  {0x93ba47c980e98cdfULL, 0xc66f336c36b10137ULL},
+  {0xb8a8d9bbe123f017ULL, 0xb80b0047445d4184ULL},
+  {0xe6d3102ad96cec1dULL, 0xa60dc059157491e5ULL},
+  {0x9043ea1ac7e41392ULL, 0x87c89837ad68db2fULL},
+  {0xb454e4a179dd1877ULL, 0x29babe4598c311fbULL},
+  {0xe16a1dc9d8545e94ULL, 0xf4296dd6fef3d67aULL},
+  {0x8ce2529e2734bb1dULL, 0x1899e4a65f58660cULL},
+  {0xb01ae745b101e9e4ULL, 0x5ec05dcff72e7f8fULL},
+  {0xdc21a1171d42645dULL, 0x76707543f4fa1f73ULL},
+  {0x899504ae72497ebaULL, 0x6a06494a791c53a8ULL},
+  {0xabfa45da0edbde69ULL, 0x0487db9d17636892ULL},
+  {0xd6f8d7509292d603ULL, 0x45a9d2845d3c42b6ULL},
+  {0x865b86925b9bc5c2ULL, 0x0b8a2392ba45a9b2ULL},
+  {0xa7f26836f282b732ULL, 0x8e6cac7768d7141eULL},
+  {0xd1ef0244af2364ffULL, 0x3207d795430cd926ULL},
+  {0x8335616aed761f1fULL, 0x7f44e6bd49e807b8ULL},
+  {0xa402b9c5a8d3a6e7ULL, 0x5f16206c9c6209a6ULL},
+  {0xcd036837130890a1ULL, 0x36dba887c37a8c0fULL},
+  {0x802221226be55a64ULL, 0xc2494954da2c9789ULL},
+  {0xa02aa96b06deb0fdULL, 0xf2db9baa10b7bd6cULL},
+  {0xc83553c5c8965d3dULL, 0x6f92829494e5acc7ULL},
+  {0xfa42a8b73abbf48cULL, 0xcb772339ba1f17f9ULL},
+  {0x9c69a97284b578d7ULL, 0xff2a760414536efbULL},
+  {0xc38413cf25e2d70dULL, 0xfef5138519684abaULL},
+  {0xf46518c2ef5b8cd1ULL, 0x7eb258665fc25d69ULL},
+  {0x98bf2f79d5993802ULL, 0xef2f773ffbd97a61ULL},
+  {0xbeeefb584aff8603ULL, 0xaafb550ffacfd8faULL},
+  {0xeeaaba2e5dbf6784ULL, 0x95ba2a53f983cf38ULL},
+  {0x952ab45cfa97a0b2ULL, 0xdd945a747bf26183ULL},
+  {0xba756174393d88dfULL, 0x94f971119aeef9e4ULL},
+  {0xe912b9d1478ceb17ULL, 0x7a37cd5601aab85dULL},
+  {0x91abb422ccb812eeULL, 0xac62e055c10ab33aULL},
+  {0xb616a12b7fe617aaULL, 0x577b986b314d6009ULL},
+  {0xe39c49765fdf9d94ULL, 0xed5a7e85fda0b80bULL},
+  {0x8e41ade9fbebc27dULL, 0x14588f13be847307ULL},
+  {0xb1d219647ae6b31cULL, 0x596eb2d8ae258fc8ULL},
+  {0xde469fbd99a05fe3ULL, 0x6fca5f8ed9aef3bbULL},
+  {0x8aec23d680043beeULL, 0x25de7bb9480d5854ULL},
+  {0xada72ccc20054ae9ULL, 0xaf561aa79a10ae6aULL},
+  {0xd910f7ff28069da4ULL, 0x1b2ba1518094da04ULL},
+  {0x87aa9aff79042286ULL, 0x90fb44d2f05d0842ULL},
+  {0xa99541bf57452b28ULL, 0x353a1607ac744a53ULL},
+  {0xd3fa922f2d1675f2ULL, 0x42889b8997915ce8ULL},
+  {0x847c9b5d7c2e09b7ULL, 0x69956135febada11ULL},
+  {0xa59bc234db398c25ULL, 0x43fab9837e699095ULL},
+  {0xcf02b2c21207ef2eULL, 0x94f967e45e03f4bbULL},
+  {0x8161afb94b44f57dULL, 0x1d1be0eebac278f5ULL},
+  {0xa1ba1ba79e1632dcULL, 0x6462d92a69731732ULL},
+  {0xca28a291859bbf93ULL, 0x7d7b8f7503cfdcfeULL},
+  {0xfcb2cb35e702af78ULL, 0x5cda735244c3d43eULL},
+  {0x9defbf01b061adabULL, 0x3a0888136afa64a7ULL},
+  {0xc56baec21c7a1916ULL, 0x088aaa1845b8fdd0ULL},
+  {0xf6c69a72a3989f5bULL, 0x8aad549e57273d45ULL},
+  {0x9a3c2087a63f6399ULL, 0x36ac54e2f678864bULL},
+  {0xc0cb28a98fcf3c7fULL, 0x84576a1bb416a7ddULL},
+  {0xf0fdf2d3f3c30b9fULL, 0x656d44a2a11c51d5ULL},
+  {0x969eb7c47859e743ULL, 0x9f644ae5a4b1b325ULL},
+  {0xbc4665b596706114ULL, 0x873d5d9f0dde1feeULL},
+  {0xeb57ff22fc0c7959ULL, 0xa90cb506d155a7eaULL},
+  {0x9316ff75dd87cbd8ULL, 0x09a7f12442d588f2ULL},
+  {0xb7dcbf5354e9beceULL, 0x0c11ed6d538aeb2fULL},
+  {0xe5d3ef282a242e81ULL, 0x8f1668c8a86da5faULL},
+  {0x8fa475791a569d10ULL, 0xf96e017d694487bcULL},
+  {0xb38d92d760ec4455ULL, 0x37c981dcc395a9acULL},
+  {0xe070f78d3927556aULL, 0x85bbe253f47b1417ULL},
+  {0x8c469ab843b89562ULL, 0x93956d7478ccec8eULL},
+  {0xaf58416654a6babbULL, 0x387ac8d1970027b2ULL},
+  {0xdb2e51bfe9d0696aULL, 0x06997b05fcc0319eULL},
+  {0x88fcf317f22241e2ULL, 0x441fece3bdf81f03ULL},
+  {0xab3c2fddeeaad25aULL, 0xd527e81cad7626c3ULL},
+  {0xd60b3bd56a5586f1ULL, 0x8a71e223d8d3b074ULL},
+  {0x85c7056562757456ULL, 0xf6872d5667844e49ULL},
+  {0xa738c6bebb12d16cULL, 0xb428f8ac016561dbULL},
+  {0xd106f86e69d785c7ULL, 0xe13336d701beba52ULL},
+  {0x82a45b450226b39cULL, 0xecc0024661173473ULL},
+  {0xa34d721642b06084ULL, 0x27f002d7f95d0190ULL},
+  {0xcc20ce9bd35c78a5ULL, 0x31ec038df7b441f4ULL},
+  {0xff290242c83396ceULL, 0x7e67047175a15271ULL},
+  {0x9f79a169bd203e41ULL, 0x0f0062c6e984d386ULL},
+  {0xc75809c42c684dd1ULL, 0x52c07b78a3e60868ULL},
+  {0xf92e0c3537826145ULL, 0xa7709a56ccdf8a82ULL},
+  {0x9bbcc7a142b17ccbULL, 0x88a66076400bb691ULL},
+  {0xc2abf989935ddbfeULL, 0x6acff893d00ea435ULL},
+  {0xf356f7ebf83552feULL, 0x0583f6b8c4124d43ULL},
+  {0x98165af37b2153deULL, 0xc3727a337a8b704aULL},
+  {0xbe1bf1b059e9a8d6ULL, 0x744f18c0592e4c5cULL},
+  {0xeda2ee1c7064130cULL, 0x1162def06f79df73ULL},
+  {0x9485d4d1c63e8be7ULL, 0x8addcb5645ac2ba8ULL},
+  {0xb9a74a0637ce2ee1ULL, 0x6d953e2bd7173692ULL},
+  {0xe8111c87c5c1ba99ULL, 0xc8fa8db6ccdd0437ULL},
+  {0x910ab1d4db9914a0ULL, 0x1d9c9892400a22a2ULL},
+  {0xb54d5e4a127f59c8ULL, 0x2503beb6d00cab4bULL},
+  {0xe2a0b5dc971f303aULL, 0x2e44ae64840fd61dULL},
+  {0x8da471a9de737e24ULL, 0x5ceaecfed289e5d2ULL},
+  {0xb10d8e1456105dadULL, 0x7425a83e872c5f47ULL},
+  {0xdd50f1996b947518ULL, 0xd12f124e28f77719ULL},
+  {0x8a5296ffe33cc92fULL, 0x82bd6b70d99aaa6fULL},
+  {0xace73cbfdc0bfb7bULL, 0x636cc64d1001550bULL},
+  {0xd8210befd30efa5aULL, 0x3c47f7e05401aa4eULL},
+  {0x8714a775e3e95c78ULL, 0x65acfaec34810a71ULL},
+  {0xa8d9d1535ce3b396ULL, 0x7f1839a741a14d0dULL},
+  {0xd31045a8341ca07cULL, 0x1ede48111209a050ULL},
+  {0x83ea2b892091e44dULL, 0x934aed0aab460432ULL},
+  {0xa4e4b66b68b65d60ULL, 0xf81da84d5617853fULL},
+  {0xce1de40642e3f4b9ULL, 0x36251260ab9d668eULL},
+  {0x80d2ae83e9ce78f3ULL, 0xc1d72b7c6b426019ULL},
+  {0xa1075a24e4421730ULL, 0xb24cf65b8612f81fULL},
+  {0xc94930ae1d529cfcULL, 0xdee033f26797b627ULL},
+  {0xfb9b7cd9a4a7443cULL, 0x169840ef017da3b1ULL},
+  {0x9d412e0806e88aa5ULL, 0x8e1f289560ee864eULL},
+  {0xc491798a08a2ad4eULL, 0xf1a6f2bab92a27e2ULL},
+  {0xf5b5d7ec8acb58a2ULL, 0xae10af696774b1dbULL},
+  {0x9991a6f3d6bf1765ULL, 0xacca6da1e0a8ef29ULL},
+  {0xbff610b0cc6edd3fULL, 0x17fd090a58d32af3ULL},
+  {0xeff394dcff8a948eULL, 0xddfc4b4cef07f5b0ULL},
+  {0x95f83d0a1fb69cd9ULL, 0x4abdaf101564f98eULL},
+  {0xbb764c4ca7a4440fULL, 0x9d6d1ad41abe37f1ULL},
+  {0xea53df5fd18d5513ULL, 0x84c86189216dc5edULL},
+  {0x92746b9be2f8552cULL, 0x32fd3cf5b4e49bb4ULL},
+  {0xb7118682dbb66a77ULL, 0x3fbc8c33221dc2a1ULL},
+  {0xe4d5e82392a40515ULL, 0x0fabaf3feaa5334aULL},
+  {0x8f05b1163ba6832dULL, 0x29cb4d87f2a7400eULL},
+  {0xb2c71d5bca9023f8ULL, 0x743e20e9ef511012ULL},
+  {0xdf78e4b2bd342cf6ULL, 0x914da9246b255416ULL},
+  {0x8bab8eefb6409c1aULL, 0x1ad089b6c2f7548eULL},
+  {0xae9672aba3d0c320ULL, 0xa184ac2473b529b1ULL},
+  {0xda3c0f568cc4f3e8ULL, 0xc9e5d72d90a2741eULL},
+  {0x8865899617fb1871ULL, 0x7e2fa67c7a658892ULL},
+  {0xaa7eebfb9df9de8dULL, 0xddbb901b98feeab7ULL},
+  {0xd51ea6fa85785631ULL, 0x552a74227f3ea565ULL},
+  {0x8533285c936b35deULL, 0xd53a88958f87275fULL},
+  {0xa67ff273b8460356ULL, 0x8a892abaf368f137ULL},
+  {0xd01fef10a657842cULL, 0x2d2b7569b0432d85ULL},
+  {0x8213f56a67f6b29bULL, 0x9c3b29620e29fc73ULL},
+  {0xa298f2c501f45f42ULL, 0x8349f3ba91b47b8fULL},
+  {0xcb3f2f7642717713ULL, 0x241c70a936219a73ULL},
+  {0xfe0efb53d30dd4d7ULL, 0xed238cd383aa0110ULL},
+  {0x9ec95d1463e8a506ULL, 0xf4363804324a40aaULL},
+  {0xc67bb4597ce2ce48ULL, 0xb143c6053edcd0d5ULL},
+  {0xf81aa16fdc1b81daULL, 0xdd94b7868e94050aULL},
+  {0x9b10a4e5e9913128ULL, 0xca7cf2b4191c8326ULL},
+  {0xc1d4ce1f63f57d72ULL, 0xfd1c2f611f63a3f0ULL},
+  {0xf24a01a73cf2dccfULL, 0xbc633b39673c8cecULL},
+  {0x976e41088617ca01ULL, 0xd5be0503e085d813ULL},
+  {0xbd49d14aa79dbc82ULL, 0x4b2d8644d8a74e18ULL},
+  {0xec9c459d51852ba2ULL, 0xddf8e7d60ed1219eULL},
+  {0x93e1ab8252f33b45ULL, 0xcabb90e5c942b503ULL},
+  {0xb8da1662e7b00a17ULL, 0x3d6a751f3b936243ULL},
+  {0xe7109bfba19c0c9dULL, 0x0cc512670a783ad4ULL},
+  {0x906a617d450187e2ULL, 0x27fb2b80668b24c5ULL},
+  {0xb484f9dc9641e9daULL, 0xb1f9f660802dedf6ULL},
+  {0xe1a63853bbd26451ULL, 0x5e7873f8a0396973ULL},
+  {0x8d07e33455637eb2ULL, 0xdb0b487b6423e1e8ULL},
+  {0xb049dc016abc5e5fULL, 0x91ce1a9a3d2cda62ULL},
+  {0xdc5c5301c56b75f7ULL, 0x7641a140cc7810fbULL},
+  {0x89b9b3e11b6329baULL, 0xa9e904c87fcb0a9dULL},
+  {0xac2820d9623bf429ULL, 0x546345fa9fbdcd44ULL},
+  {0xd732290fbacaf133ULL, 0xa97c177947ad4095ULL},
+  {0x867f59a9d4bed6c0ULL, 0x49ed8eabcccc485dULL},
+  {0xa81f301449ee8c70ULL, 0x5c68f256bfff5a74ULL},
+  {0xd226fc195c6a2f8cULL, 0x73832eec6fff3111ULL},
+  {0x83585d8fd9c25db7ULL, 0xc831fd53c5ff7eabULL},
+  {0xa42e74f3d032f525ULL, 0xba3e7ca8b77f5e55ULL},
+  {0xcd3a1230c43fb26fULL, 0x28ce1bd2e55f35ebULL},
+  {0x80444b5e7aa7cf85ULL, 0x7980d163cf5b81b3ULL},
+  {0xa0555e361951c366ULL, 0xd7e105bcc332621fULL},
+  {0xc86ab5c39fa63440ULL, 0x8dd9472bf3fefaa7ULL},
+  {0xfa856334878fc150ULL, 0xb14f98f6f0feb951ULL},
+  {0x9c935e00d4b9d8d2ULL, 0x6ed1bf9a569f33d3ULL},
+  {0xc3b8358109e84f07ULL, 0x0a862f80ec4700c8ULL},
+  {0xf4a642e14c6262c8ULL, 0xcd27bb612758c0faULL},
+  {0x98e7e9cccfbd7dbdULL, 0x8038d51cb897789cULL},
+  {0xbf21e44003acdd2cULL, 0xe0470a63e6bd56c3ULL},
+  {0xeeea5d5004981478ULL, 0x1858ccfce06cac74ULL},
+  {0x95527a5202df0ccbULL, 0x0f37801e0c43ebc8ULL},
+  {0xbaa718e68396cffdULL, 0xd30560258f54e6baULL},
+  {0xe950df20247c83fdULL, 0x47c6b82ef32a2069ULL},
+  {0x91d28b7416cdd27eULL, 0x4cdc331d57fa5441ULL},
+  {0xb6472e511c81471dULL, 0xe0133fe4adf8e952ULL},
+  {0xe3d8f9e563a198e5ULL, 0x58180fddd97723a6ULL},
+  {0x8e679c2f5e44ff8fULL, 0x570f09eaa7ea7648ULL}};
+
+//Computes the double nearest to w * 10^q following Eisel and Lemire,
+//"Number Parsing at a Gigabyte per Second". w has at most 19 digits,
+//for which the 128-bit product is always precise enough.
+#if defined(__SIZEOF_INT128__)
+static uint64_t eisel_lemire (uint64_t w, int64_t q){
+  if(q < -342) return 0;
+  if(q > 308) return 0x7FF0000000000000ULL;
+  int lz = __builtin_clzll(w);
+  w <<= lz;
+  const uint64_t* t = powers_of_five[q + 342];
+  __uint128_t first = (__uint128_t)w * t[0];
+  uint64_t hi = (uint64_t)(first >> 64);
+  uint64_t lo = (uint64_t)first;
+  if((hi & 0x1FF) == 0x1FF){
+    uint64_t second = (uint64_t)(((__uint128_t)w * t[1]) >> 64);
+    lo += second;
+    if(second > lo) hi++;
+  }
+  int upperbit = (int)(hi >> 63);
+  int shift = upperbit + 9;
+  uint64_t mantissa = hi >> shift;
+  int64_t power2 = (((152170 + 65536) * q) >> 16) + 63 + upperbit - lz + 1023;
+  if(power2 <= 0){
+    if(-power2 + 1 >= 64) return 0;
+    mantissa >>= -power2 + 1;
+    mantissa += mantissa & 1;
+    mantissa >>= 1;
+    return mantissa;
+  }
+  //Round to even when the product is exactly halfway.
+  if(lo <= 1 && q >= -4 && q <= 23 && (mantissa & 3) == 1 && (mantissa << shift) == hi)
+    mantissa &= ~(uint64_t)1;
+  mantissa += mantissa & 1;
+  mantissa >>= 1;
+  if(mantissa >= (uint64_t)2 << 52){
+    mantissa = (uint64_t)1 << 52;
+    power2++;
+  }
+  mantissa &= ~((uint64_t)1 << 52);
+  if(power2 >= 0x7FF) return 0x7FF0000000000000ULL;
+  return mantissa | ((uint64_t)power2 << 52);
+}
+#endif
+
+static const double exact_powers_of_ten[] = {
+  1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+//Parses p[0 .. n) as a plain decimal number of at most 19 significant
+//digits. Returns 0 if the number has another form, so that it can be
+//given to strtod instead.
+static int parse_simple_double (const char* p, int64_t n, double* out){
+  const char* end = p + n;
+  int negative = 0;
+  if(p < end && (*p == '-' || *p == '+')){
+    negative = *p == '-';
+    p++;
+  }
+  uint64_t w = 0;
+  int64_t ndigits = 0;
+  int64_t q = 0;
+  int any = 0;
+  while(p < end && *p == '0'){ p++; any = 1; }
+  for(; p < end && (unsigned)(*p - '0') <= 9; p++, ndigits++)
+    w = w * 10 + (uint64_t)(*p - '0');
+  if(p < end && *p == '.'){
+    p++;
+    if(ndigits == 0)
+      for(; p < end && *p == '0'; p++, q--) any = 1;
+    for(; p < end && (unsigned)(*p - '0') <= 9; p++, ndigits++, q--)
+      w = w * 10 + (uint64_t)(*p - '0');
+  }
+  if(!any && ndigits == 0) return 0;
+  if(ndigits > 19) return 0;
+  if(p < end && (*p == 'e' || *p == 'E')){
+    p++;
+    int eneg = 0;
+    if(p < end && (*p == '-' || *p == '+')){
+      eneg = *p == '-';
+      p++;
+    }
+    if(p == end || (unsigned)(*p - '0') > 9) return 0;
+    int64_t e = 0;
+    for(; p < end && (unsigned)(*p - '0') <= 9; p++)
+      if(e < 100000) e = e * 10 + (*p - '0');
+    q += eneg ? -e : e;
+  }
+  if(p != end) return 0;
+  double d;
+  if(w == 0)
+    d = 0.0;
+  else if(w <= (uint64_t)1 << 53 && q >= -22 && q <= 22)
+    d = q < 0 ? (double)w / exact_powers_of_ten[-q] : (double)w * exact_powers_of_ten[q];
+  else{
+#if defined(__SIZEOF_INT128__)
+    uint64_t bits = eisel_lemire(w, q);
+    memcpy(&d, &bits, 8);
+#else
+    return 0;
+#endif
+  }
+  *out = negative ? -d : d;
+  return 1;
+}
+
+//Copies p[0 .. n) into a null-terminated buffer for the C library.
+//Returns a pointer to small if it fits, or else a fresh allocation.
+static char* terminated_copy (const char* p, int64_t n, char* small, int64_t size){
+  char* s = n < size ? small : (char*)malloc(n + 1);
+  memcpy(s, p, n);
+  s[n] = 0;
+  return s;
+}
+
+//Parses p[0 .. n) as a double in the syntax accepted by strtod.
+//Returns 1 and writes the value to out if the whole string is a number.
+int stz_parse_double (const char* p, int64_t n, double* out){
+  if(parse_simple_double(p, n, out)) return 1;
+  char small[64];
+  char* s = terminated_copy(p, n, small, sizeof(small));
+  char* end;
+  *out = strtod(s, &end);
+  int ok = end != s && end == s + n;
+  if(s != small) free(s);
+  return ok;
+}
+
+//Parses p[0 .. n) as a float in the syntax accepted by strtof.
+//Returns 1 and writes the value to out if the whole string is a number.
+int stz_parse_float (const char* p, int64_t n, float* out){
+  char small[64];
+  char* s = terminated_copy(p, n, small, sizeof(small));
+  char* end;
+  *out = strtof(s, &end);
+  int ok = end != s && end == s + n;
+  if(s != small) free(s);
+  return ok;
+}
+
+//============================================================
+//========================= Lexer ============================
+//============================================================
+
+//Lexer for whole files read by the Stanza reader. It follows tokenize
+//in core/reader.stanza, which remains in use for interactive input,
+//but scans the text in a single pass with a table of character
+//classes. Each lexeme is recorded as a LexToken for the reader to turn
+//into a Token. The text of each lexeme is copied into a byte buffer
+//outside of the Stanza heap, with strings, characters and escaped
+//symbols unescaped.
+
+enum {
+  LEX_INDENTATION, LEX_OPEN, LEX_CLOSE, LEX_QUOTE, LEX_CAPTURE,
+  LEX_IDENTIFIER, LEX_OPERATOR, LEX_NUMBER, LEX_CHAR, LEX_STRING,
+  LEX_HERE_STRING, LEX_SYMBOL, LEX_TRUE, LEX_FALSE, LEX_END
+};
+
+enum {
+  LEX_OK, LEX_INVALID_TAG, LEX_NO_END_TAG, LEX_INVALID_ESCAPE_CHAR,
+  LEX_NO_ESCAPE_SPECIFIER, LEX_UNCLOSED_STRING, LEX_UNCLOSED_CHAR,
+  LEX_UNCLOSED_SYMBOL, LEX_INVALID_CHAR_STRING, LEX_INVALID_CHAR,
+  LEX_EXTRA_CLOSING_TOKEN, LEX_WRONG_CLOSING_TOKEN
+};
+
+//The text of a lexeme, if it has one, is chars[start .. end). The
+//value is the indentation, the bracket of an OPEN or CLOSE with 256
+//added for a starred OPEN, or the character of a CHAR.
+typedef struct {
+  int32_t kind;
+  int32_t start;
+  int32_t end;
+  int32_t line;
+  int32_t column;
+  int32_t value;
+} LexToken;
+
+//If the text cannot be lexed, the tokens end before the lexeme in
+//error, and the error is recorded with its position. Its value is the
+//offending character, 1 for an unended here string rather than
+//comment, or for a wrong closing token, the open bracket shifted left
+//by 8 bits plus the closing one.
+//Lexing continues from next, on line next_line, if it stopped before
+//the end of the text.
+typedef struct {
+  LexToken* tokens;
+  int64_t length;
+  int64_t capacity;
+  char* chars;
+  int64_t chars_length;
+  int64_t chars_capacity;
+  int32_t error;
+  int32_t error_line;
+  int32_t error_column;
+  int32_t error_value;
+  int64_t next;
+  int32_t next_line;
+} LexResult;
+
+#define LEX_WHITESPACE 1
+#define LEX_NECESSARY_ID 2
+#define LEX_ID 4
+#define LEX_OPERATOR_CHAR 8
+#define LEX_OPEN_BRACE 16
+#define LEX_CLOSE_BRACE 32
+#define LEX_DIGIT 64
+#define LEX_NUMBER_CHAR 128
+
+static uint8_t lex_classes[256];
+
+static void lex_add_class (const char* cs, int c){
+  for(; *cs; cs++) lex_classes[(uint8_t)*cs] |= c;
+}
+
+static void init_lex_classes (void){
+  const char* letters = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+  const char* digits = "0123456789";
+  const char* id_punc = "~!@#$%^*+-=/";
+  lex_add_class(" ,\r", LEX_WHITESPACE);
+  lex_add_class(letters, LEX_NECESSARY_ID | LEX_ID | LEX_NUMBER_CHAR);
+  lex_add_class("_?", LEX_NECESSARY_ID | LEX_ID | LEX_NUMBER_CHAR);
+  lex_add_class(digits, LEX_DIGIT | LEX_ID | LEX_NUMBER_CHAR);
+  lex_add_class(id_punc, LEX_ID | LEX_OPERATOR_CHAR | LEX_NUMBER_CHAR);
+  lex_add_class(".", LEX_OPERATOR_CHAR | LEX_NUMBER_CHAR);
+  lex_add_class(":<&|", LEX_OPERATOR_CHAR);
+  lex_add_class("([{<", LEX_OPEN_BRACE);
+  lex_add_class(")]}>", LEX_CLOSE_BRACE);
+}
+
+typedef struct {
+  const char* text;
+  int64_t n;
+  int64_t pos;
+  int32_t line;
+  int64_t line_start;
+  char* scopes;
+  int64_t nscopes;
+  int64_t scopes_capacity;
+  LexResult* r;
+} Lexer;
+
+static inline int lex_class (Lexer* lx, int64_t i, int c){
+  return i < lx->n && (lex_classes[(uint8_t)lx->text[i]] & c);
+}
+
+static inline int lex_peek (Lexer* lx, int64_t i){
+  return i < lx->n ? (uint8_t)lx->text[i] : -1;
+}
+
+//Moves to position i, counting the lines passed over.
+static void lex_advance (Lexer* lx, int64_t i){
+  const char* p = lx->text + lx->pos;
+  const char* end = lx->text + i;
+  while((p = (const char*)memchr(p, '\n', end - p)) != NULL){
+    p++;
+    lx->line++;
+    lx->line_start = p - lx->text;
+  }
+  lx->pos = i;
+}
+
+static inline int32_t lex_column (Lexer* lx, int64_t i){
+  return (int32_t)(i - lx->line_start);
+}
+
+static LexToken* lex_add (Lexer* lx, int kind, int64_t start, int64_t end, int32_t line, int32_t column, int value){
+  LexResult* r = lx->r;
+  if(r->length == r->capacity){
+    r->capacity *= 2;
+    r->tokens = (LexToken*)realloc(r->tokens, r->capacity * sizeof(LexToken));
+  }
+  LexToken* t = &r->tokens[r->length++];
+  t->kind = kind;
+  t->start = (int32_t)start;
+  t->end = (int32_t)end;
+  t->line = line;
+  t->column = column;
+  t->value = value;
+  return t;
+}
+
+static void lex_add_chars (Lexer* lx, const char* p, int64_t n){
+  LexResult* r = lx->r;
+  if(r->chars_length + n > r->chars_capacity){
+    while(r->chars_length + n > r->chars_capacity) r->chars_capacity *= 2;
+    r->chars = (char*)realloc(r->chars, r->chars_capacity);
+  }
+  memcpy(r->chars + r->chars_length, p, n);
+  r->chars_length += n;
+}
+
+static inline void lex_add_char (Lexer* lx, char c){
+  lex_add_chars(lx, &c, 1);
+}
+
+//Records the lexeme text[start .. end), and moves past it.
+static void lex_add_text (Lexer* lx, int kind, int64_t start, int64_t end, int64_t next,
+                          int32_t line, int32_t column){
+  int64_t chars_start = lx->r->chars_length;
+  lex_add_chars(lx, lx->text + start, end - start);
+  lex_add(lx, kind, chars_start, lx->r->chars_length, line, column, 0);
+  lex_advance(lx, next);
+}
+
+//Records an error at position i. Returns 0 for the caller to stop.
+static int lex_error (Lexer* lx, int error, int64_t i, int value){
+  lex_advance(lx, i);
+  lx->r->error = error;
+  lx->r->error_line = lx->line;
+  lx->r->error_column = lex_column(lx, i);
+  lx->r->error_value = value;
+  return 0;
+}
+
+//Returns the end of the identifier starting at i, or -1 if the
+//identifier characters there contain no letter, '_' or '?'.
+static int64_t lex_identifier_end (Lexer* lx, int64_t i){
+  int necessary = 0;
+  for(; lex_class(lx, i, LEX_ID); i++)
+    necessary |= lex_classes[(uint8_t)lx->text[i]] & LEX_NECESSARY_ID;
+  return necessary ? i : -1;
+}
+
+//Finds the tagged block whose tag starts with the '<' at i. Sets the
+//length of the tag and the position of the closing tag, or records an
+//error and returns 0.
+static int lex_tagged_block (Lexer* lx, int64_t i, int here_string, int64_t* tag_length, int64_t* end_tag){
+  long gt = stz_index_of_byte(lx->text + i, lx->n - i, '>');
+  if(gt < 0) return lex_error(lx, LEX_INVALID_TAG, i, 0);
+  int64_t m = gt + 1;
+  long k = stz_index_of_bytes(lx->text + i + m, lx->n - i - m, lx->text + i, m);
+  if(k < 0) return lex_error(lx, LEX_NO_END_TAG, i, here_string);
+  *tag_length = m;
+  *end_tag = i + m + k;
+  return 1;
+}
+
+static char lex_escape_char (char c){
+  switch(c){
+  case 't': return '\t';
+  case 'b': return '\b';
+  case 'r': return '\r';
+  case 'n': return '\n';
+  case '\\': case '"': case '\'': case '|': return c;
+  default: return 0;
+  }
+}
+
+//Unescapes the characters after the bracketing character at i, up to
+//the next unescaped one, into chars. Returns the position after the
+//closing bracket, or -1 if the text ends first, or records an error
+//and returns -2.
+static int64_t lex_escaped_chars (Lexer* lx, int64_t i){
+  const char* text = lx->text;
+  char end_char = text[i];
+  for(i++; i < lx->n; i++){
+    char c = text[i];
+    if(c == end_char) return i + 1;
+    if(c != '\\'){
+      lex_add_char(lx, c);
+      continue;
+    }
+    if(++i == lx->n){
+      lex_error(lx, LEX_NO_ESCAPE_SPECIFIER, i, 0);
+      return -2;
+    }
+    c = text[i];
+    if(c == '\n'){
+      while(i + 1 < lx->n && text[i + 1] == ' ') i++;
+    }
+    else{
+      char e = lex_escape_char(c);
+      if(e == 0){
+        lex_error(lx, LEX_INVALID_ESCAPE_CHAR, i + 1, (uint8_t)c);
+        return -2;
       }
+      lex_add_char(lx, e);
     }
-    //Interpret state retrieval command
-    else if(comm == STATE_COMMAND || comm == WAIT_COMMAND){
-      //Read in process id
-      long pid = read_long(lin);
+  }
+  return -1;
+}
+
+//Lexes a string, character or escaped symbol whose bracketing
+//character is at i.
+static int lex_escaped (Lexer* lx, int kind, int64_t start, int64_t i, int unclosed){
+  int32_t line = lx->line;
+  int32_t column = lex_column(lx, start);
+  int64_t chars_start = lx->r->chars_length;
+  int64_t end = lex_escaped_chars(lx, i);
+  if(end == -2) return 0;
+  if(end == -1) return lex_error(lx, unclosed, start, 0);
+  int64_t chars_end = lx->r->chars_length;
+  int value = 0;
+  if(kind == LEX_CHAR){
+    if(chars_end - chars_start != 1) return lex_error(lx, LEX_INVALID_CHAR_STRING, start, 0);
+    value = (uint8_t)lx->r->chars[chars_start];
+  }
+  lex_add(lx, kind, chars_start, chars_end, line, column, value);
+  lex_advance(lx, end);
+  return 1;
+}
+
+static int lex_operator_char (Lexer* lx, int64_t i){
+  if(lex_peek(lx, i) == '>')
+    return lx->nscopes == 0 || lx->scopes[lx->nscopes - 1] != '<';
+  return lex_class(lx, i, LEX_OPERATOR_CHAR);
+}
+
+//Pushes or pops the scope of a bracket, or records an error.
+static int lex_update_scopes (Lexer* lx, int64_t i, char c){
+  if(lex_classes[(uint8_t)c] & LEX_OPEN_BRACE){
+    if(lx->nscopes == lx->scopes_capacity){
+      lx->scopes_capacity *= 2;
+      lx->scopes = (char*)realloc(lx->scopes, lx->scopes_capacity);
+    }
+    lx->scopes[lx->nscopes++] = c;
+    return 1;
+  }
+  char open = c == '>' ? '<' : c == ']' ? '[' : c == '}' ? '{' : '(';
+  if(lx->nscopes == 0)
+    return lex_error(lx, LEX_EXTRA_CLOSING_TOKEN, i, (uint8_t)c);
+  char top = lx->scopes[lx->nscopes - 1];
+  if(top != open)
+    return lex_error(lx, LEX_WRONG_CLOSING_TOKEN, i, ((uint8_t)top << 8) | (uint8_t)c);
+  lx->nscopes--;
+  return 1;
+}
 
-      //Retrieve state
-      ProcessState s; get_process_state(pid, &s, comm == WAIT_COMMAND);
-      write_process_state(lout, &s);
-      fflush(lout);
+//Lexes the lexeme at the current position, followed by a starred open
+//bracket if one comes directly after it.
+static int lex_lexeme (Lexer* lx){
+  const char* text = lx->text;
+  int64_t i = lx->pos;
+  int32_t line = lx->line;
+  int32_t column = lex_column(lx, i);
+  int c = (uint8_t)text[i];
+  int c1 = lex_peek(lx, i + 1);
+  int kind = -1;
+  int64_t end;
+  //Capture, e.g. ?x
+  if(c == '?' && (end = lex_identifier_end(lx, i + 1)) >= 0){
+    kind = LEX_CAPTURE;
+    lex_add_text(lx, kind, i + 1, end, end, line, column);
+  }
+  //Here string, e.g. \<STR>text<STR>
+  else if(c == '\\' && c1 == '<'){
+    int64_t tag_length, end_tag;
+    if(!lex_tagged_block(lx, i + 1, 1, &tag_length, &end_tag)) return 0;
+    kind = LEX_HERE_STRING;
+    lex_add_text(lx, kind, i + 1 + tag_length, end_tag, end_tag + tag_length, line, column);
+  }
+  //Escaped symbol, e.g. \|my symbol|
+  else if(c == '\\' && c1 == '|'){
+    kind = LEX_SYMBOL;
+    if(!lex_escaped(lx, kind, i, i + 1, LEX_UNCLOSED_SYMBOL)) return 0;
+  }
+  //Character, e.g. 'c'
+  else if(c == '\''){
+    kind = LEX_CHAR;
+    if(!lex_escaped(lx, kind, i, i, LEX_UNCLOSED_CHAR)) return 0;
+  }
+  //String, e.g. "text"
+  else if(c == '"'){
+    kind = LEX_STRING;
+    if(!lex_escaped(lx, kind, i, i, LEX_UNCLOSED_STRING)) return 0;
+  }
+  //Number, e.g. -103L
+  else if(lex_class(lx, i, LEX_DIGIT) || (c == '-' && lex_class(lx, i + 1, LEX_DIGIT))){
+    kind = LEX_NUMBER;
+    for(end = i + 1; lex_class(lx, end, LEX_NUMBER_CHAR); end++);
+    lex_add_text(lx, kind, i, end, end, line, column);
+  }
+  //Identifier, e.g. my/identifier
+  else if((end = lex_identifier_end(lx, i)) >= 0){
+    kind = LEX_IDENTIFIER;
+    if(end - i == 4 && memcmp(text + i, "true", 4) == 0) kind = LEX_TRUE;
+    else if(end - i == 5 && memcmp(text + i, "false", 5) == 0) kind = LEX_FALSE;
+    lex_add_text(lx, kind, i, end, end, line, column);
+  }
+  else{
+    //Operator, the shortest that is not followed by identifier
+    //characters that make up an identifier, e.g. <:
+    for(end = i; lex_operator_char(lx, end); end++);
+    if(lex_class(lx, end, LEX_NECESSARY_ID))
+      while(end > i && lex_class(lx, end - 1, LEX_ID)) end--;
+    if(end > i){
+      kind = LEX_OPERATOR;
+      lex_add_text(lx, kind, i, end, end, line, column);
+    }
+    //Brackets and quotes, e.g. [
+    else if(lex_classes[c] & (LEX_OPEN_BRACE | LEX_CLOSE_BRACE)){
+      kind = lex_classes[c] & LEX_OPEN_BRACE ? LEX_OPEN : LEX_CLOSE;
+      if(!lex_update_scopes(lx, i, (char)c)) return 0;
+      lex_add(lx, kind, i, i + 1, line, column, c);
+      lex_advance(lx, i + 1);
+    }
+    else if(c == '`'){
+      kind = LEX_QUOTE;
+      lex_add(lx, kind, i, i + 1, line, column, 0);
+      lex_advance(lx, i + 1);
     }
-    //Unrecognized command
     else{
-      fprintf(stderr, "Illegal command: %d\n", comm);
-      exit(-1);
-    }
-  }
-}
-
-long launcher_pid = -1;
-FILE* launcher_in = NULL;
-FILE* launcher_out = NULL;
-void initialize_launcher_process (){
-  if(launcher_pid < 0){    
-    //Create pipes
-    int READ = 0;
-    int WRITE = 1;
-    int lin[2];
-    int lout[2];
-    if(pipe(lin) < 0) exit_with_error();
-    if(pipe(lout) < 0) exit_with_error();
-
-    //Fork
-    long pid = (long)fork();
-    if(pid < 0) exit_with_error();
-
-    if(pid > 0){
-      //Parent
-      launcher_pid = pid;
-      close(lin[READ]);
-      close(lout[WRITE]);
-      launcher_in = fdopen(lin[WRITE], "w");
-      if(launcher_in == NULL) exit_with_error();
-      launcher_out = fdopen(lout[READ], "r");
-      if(launcher_out == NULL) exit_with_error();
+      return lex_error(lx, LEX_INVALID_CHAR, i, c);
+    }
+  }
+  //Starred open bracket, e.g. the bracket in f(x)
+  if(kind != LEX_OPEN && kind != LEX_QUOTE && kind != LEX_OPERATOR &&
+     lex_class(lx, lx->pos, LEX_OPEN_BRACE)){
+    i = lx->pos;
+    c = (uint8_t)text[i];
+    if(!lex_update_scopes(lx, i, (char)c)) return 0;
+    lex_add(lx, LEX_OPEN, i, i + 1, lx->line, lex_column(lx, i), c + 256);
+    lex_advance(lx, i + 1);
+  }
+  return 1;
+}
+
+//Skips whitespace and comments. Returns 0 if a multiline comment is
+//not well formed.
+static int lex_skip_ignored (Lexer* lx){
+  const char* text = lx->text;
+  for(;;){
+    int64_t i = lx->pos;
+    while(lex_class(lx, i, LEX_WHITESPACE)) i++;
+    if(i < lx->n && text[i] == ';'){
+      if(lex_peek(lx, i + 1) == '<'){
+        int64_t tag_length, end_tag;
+        if(!lex_tagged_block(lx, i + 1, 0, &tag_length, &end_tag)) return 0;
+        lex_advance(lx, end_tag + tag_length);
+      }
+      else{
+        long k = stz_index_of_byte(text + i, lx->n - i, '\n');
+        lx->pos = k < 0 ? lx->n : i + k;
+      }
     }
     else{
-      //Child
-      close(lin[WRITE]);
-      close(lout[READ]);
-      FILE* fin = fdopen(lin[READ], "r");
-      if(fin == NULL) exit_with_error();
-      FILE* fout = fdopen(lout[WRITE], "w");
-      if(fout == NULL) exit_with_error();
-      launcher_main(fin, fout);
+      lx->pos = i;
+      return 1;
+    }
+  }
+}
+
+//Lexes the n bytes of text, which begin at the start of the given
+//line. Lexing stops at the end of the text, or before the first line
+//at or past limit whose first lexeme is at column 0 outside of any
+//bracket, where a new top-level form begins. Either way the tokens end
+//with an END token, and next and next_line are set to where lexing
+//stopped. The result is freed with free_lex_result.
+LexResult* stz_lex_lines (const char* text, int64_t n, int32_t line, int64_t limit){
+  static int initialized = 0;
+  if(!initialized){
+    init_lex_classes();
+    initialized = 1;
+  }
+  int64_t size = limit < n ? limit : n;
+  LexResult* r = (LexResult*)malloc(sizeof(LexResult));
+  r->capacity = 64 + size / 4;
+  r->tokens = (LexToken*)malloc(r->capacity * sizeof(LexToken));
+  r->length = 0;
+  r->chars_capacity = 64 + size / 8;
+  r->chars = (char*)malloc(r->chars_capacity);
+  r->chars_length = 0;
+  r->error = LEX_OK;
+  r->next = n;
+  r->next_line = line;
+  Lexer lx = {text, n, 0, line, 0, (char*)malloc(64), 0, 64, r};
+  int32_t last_indented_line = line - 1;
+  for(;;){
+    if(!lex_skip_ignored(&lx)) break;
+    if(lx.pos == n){
+      lex_add(&lx, LEX_END, n, n, lx.line, lex_column(&lx, n), 0);
+      break;
+    }
+    if(text[lx.pos] == '\n'){
+      lex_advance(&lx, lx.pos + 1);
+      continue;
+    }
+    if(lx.line > last_indented_line){
+      last_indented_line = lx.line;
+      int32_t column = lex_column(&lx, lx.pos);
+      if(lx.pos >= limit && column == 0 && lx.nscopes == 0){
+        lex_add(&lx, LEX_END, lx.pos, lx.pos, lx.line, 0, 0);
+        r->next = lx.pos;
+        break;
+      }
+      lex_add(&lx, LEX_INDENTATION, lx.pos, lx.pos, lx.line, column, column);
     }
+    if(!lex_lexeme(&lx)) break;
   }
+  r->next_line = lx.line;
+  free(lx.scopes);
+  return r;
+}
+
+//Lexes the n bytes of text.
+LexResult* stz_lex (const char* text, int64_t n){
+  return stz_lex_lines(text, n, 1, n);
 }
 
-void make_pipe_name (char* pipe_name, int pipeid) {
-  sprintf(pipe_name, "/tmp/stanza_exec_pipe_%ld_%ld", (long)getpid(), (long)pipeid);
+void free_lex_result (LexResult* r){
+  free(r->tokens);
+  free(r->chars);
+  free(r);
 }
 
-int delete_process_pipe (FILE* fd, char* pipe_name, char* suffix) {
-  if (fd != NULL) {
-    int close_res = fclose(fd);
-    if (close_res == EOF) return -1;
-    char my_pipe_name[80];
-    sprintf(my_pipe_name, "%s%s", pipe_name, suffix);
-    int rm_res = remove(my_pipe_name);
-    if (rm_res < 0) return -1;
+//============================================================
+//================= Stanza Memory Allocator ==================
+//============================================================
+
+void* stz_malloc (long size){
+  #if defined(FMALLOC)
+    return fmalloc(size);
+  #else
+    return malloc(size);
+  #endif
+}
+
+void stz_free (void* ptr){
+  #if defined(FMALLOC)
+    ffree(ptr);
+  #else
+    free(ptr);
+  #endif
+}
+
+//============================================================
+//========================= Arenas ===========================
+//============================================================
+
+//An arena hands out memory by bumping a pointer through a chain of
+//blocks. Individual allocations are never freed. Instead the whole
+//arena is either reset, which keeps the first block for reuse, or
+//freed.
+
+typedef struct ArenaBlock {
+  struct ArenaBlock* next;
+  long size;
+  char data[];
+} ArenaBlock;
+
+typedef struct {
+  ArenaBlock* blocks;
+  char* top;
+  char* limit;
+  long block_size;
+  long allocated;
+} Arena;
+
+static ArenaBlock* make_arena_block (long size, ArenaBlock* next){
+  ArenaBlock* b = (ArenaBlock*)stz_malloc(sizeof(ArenaBlock) + size);
+  b->next = next;
+  b->size = size;
+  return b;
+}
+
+Arena* arena_create (long block_size){
+  Arena* a = (Arena*)stz_malloc(sizeof(Arena));
+  a->block_size = block_size;
+  a->blocks = make_arena_block(block_size, NULL);
+  a->top = a->blocks->data;
+  a->limit = a->top + block_size;
+  a->allocated = 0;
+  return a;
+}
+
+void* arena_alloc (Arena* a, long size){
+  size = (size + 7) & -8;
+  if(a->top + size > a->limit){
+    long block_size = size > a->block_size ? size : a->block_size;
+    a->blocks = make_arena_block(block_size, a->blocks);
+    a->top = a->blocks->data;
+    a->limit = a->top + block_size;
   }
+  void* ptr = a->top;
+  a->top += size;
+  a->allocated += size;
+  return ptr;
+}
+
+//Free all blocks except the oldest one, which is
+//always of the default block size.
+int arena_reset (Arena* a){
+  ArenaBlock* b = a->blocks;
+  while(b->next != NULL){
+    ArenaBlock* next = b->next;
+    stz_free(b);
+    b = next;
+  }
+  a->blocks = b;
+  a->top = b->data;
+  a->limit = b->data + b->size;
+  a->allocated = 0;
   return 0;
 }
 
-int delete_process_pipes (FILE* input, FILE* output, FILE* error, int pipeid) {
-  char pipe_name[80];
-  make_pipe_name(pipe_name, pipeid);
-  if (delete_process_pipe(input,  pipe_name, "_in") < 0)
-    return -1;
-  if (delete_process_pipe(output, pipe_name, "_out") < 0)
-    return -1;
-  if (delete_process_pipe(error,  pipe_name, "_err") < 0)
-    return -1;
+int arena_free (Arena* a){
+  ArenaBlock* b = a->blocks;
+  while(b != NULL){
+    ArenaBlock* next = b->next;
+    stz_free(b);
+    b = next;
+  }
+  stz_free(a);
+  return 0;
+}
+
+long arena_allocated (Arena* a){
+  return a->allocated;
+}
+
+//============================================================
+//================= Process Runtime ==========================
+//============================================================
+#if defined(PLATFORM_OS_X) || defined(PLATFORM_LINUX)
+
+//Child processes are started with posix_spawnp, which avoids
+//copying the page tables of the parent, and talk to the parent
+//through anonymous pipes. The pipe ends are created close-on-exec
+//so that children never inherit each other's pipes.
+
+extern char** environ;
+
+#ifdef PLATFORM_LINUX
+int pipe2 (int fds[2], int flags);
+#endif
+
+//------------------------------------------------------------
+//------------------- Structures -----------------------------
+//------------------------------------------------------------
+
+typedef struct {
+  long pid;
+  int pipes_open;
+  FILE* in;
+  FILE* out;
+  FILE* err;
+} Process;
+
+typedef struct {
+  int state;
+  int code;
+} ProcessState;
+
+#define PROCESS_RUNNING 0
+#define PROCESS_DONE 1
+#define PROCESS_TERMINATED 2
+#define PROCESS_STOPPED 3
+
+#define STANDARD_IN 0
+#define STANDARD_OUT 1
+#define PROCESS_IN 2
+#define PROCESS_OUT 3
+#define STANDARD_ERR 4
+#define PROCESS_ERR 5
+#define NUM_STREAM_SPECS 6
+
+//------------------------------------------------------------
+//-------------------- Utilities -----------------------------
+//------------------------------------------------------------
+
+//Create a pipe whose ends are closed in the child on exec.
+static int make_cloexec_pipe (int fds[2]){
+#ifdef PLATFORM_LINUX
+  return pipe2(fds, O_CLOEXEC);
+#else
+  if(pipe(fds) < 0) return -1;
+  fcntl(fds[0], F_SETFD, FD_CLOEXEC);
+  fcntl(fds[1], F_SETFD, FD_CLOEXEC);
   return 0;
+#endif
+}
+
+//Close all open pipe ends, preserving errno.
+static void close_pipes (int pipes[NUM_STREAM_SPECS][2]){
+  int code = errno;
+  for(int i=0; i<NUM_STREAM_SPECS; i++)
+    for(int j=0; j<2; j++)
+      if(pipes[i][j] >= 0) close(pipes[i][j]);
+  errno = code;
+}
+
+//Wrap the parent end of a pipe in a stream, and mark it as taken.
+static FILE* open_pipe_stream (int* fd, char* mode){
+  if(*fd < 0) return NULL;
+  FILE* f = fdopen(*fd, mode);
+  if(f != NULL) *fd = -1;
+  return f;
 }
 
+//------------------------------------------------------------
+//-------------------- Process Launching ---------------------
+//------------------------------------------------------------
+
 int launch_process (char* file, char** argvs,
-                    int input, int output, int error, int pipeid,
+                    int input, int output, int error,
                     Process* process){
-  //Initialize launcher if necessary
-  initialize_launcher_process();
-  
-  //Figure out unique pipe name
-  char pipe_name[80];
-  make_pipe_name(pipe_name, pipeid);
+  int READ = 0;
+  int WRITE = 1;
 
-  //Compute pipe sources
-  int pipe_sources[NUM_STREAM_SPECS];
+  //Create the pipes named by the stream specifiers
+  int pipes[NUM_STREAM_SPECS][2];
   for(int i=0; i<NUM_STREAM_SPECS; i++)
-    pipe_sources[i] = -1;
-  pipe_sources[input] = 0;
-  pipe_sources[output] = 1;
-  pipe_sources[error] = 2;
-  
-  //Create pipes to child
-  if(pipe_sources[PROCESS_IN] >= 0)
-    RETURN_NEG(make_pipe(pipe_name, "_in"))
-  if(pipe_sources[PROCESS_OUT] >= 0)
-    RETURN_NEG(make_pipe(pipe_name, "_out"))
-  if(pipe_sources[PROCESS_ERR] >= 0)
-    RETURN_NEG(make_pipe(pipe_name, "_err"))
-  
-  //Write in command and evaluation arguments
-  EvalArg earg = {pipe_name, NULL, NULL, NULL, file, argvs};
-  if(input == PROCESS_IN) earg.in_pipe = "_in";
-  if(output == PROCESS_OUT) earg.out_pipe = "_out";
-  if(output == PROCESS_ERR) earg.out_pipe = "_err";
-  if(error == PROCESS_OUT) earg.err_pipe = "_out";
-  if(error == PROCESS_ERR) earg.err_pipe = "_err";
-  int r = fputc(LAUNCH_COMMAND, launcher_in);
-  if(r == EOF) return -1;
-  write_earg(launcher_in, &earg);
-  fflush(launcher_in);
-
-  //Open pipes to child
-  FILE* fin = NULL;
-  if(pipe_sources[PROCESS_IN] >= 0){
-    int fd = open_pipe(pipe_name, "_in", O_WRONLY);
-    RETURN_NEG(fd)
-    fin = fdopen(fd, "w");
-    if(fin == NULL) return -1;
-  }
-  FILE* fout = NULL;
-  if(pipe_sources[PROCESS_OUT] >= 0){
-    int fd = open_pipe(pipe_name, "_out", O_RDONLY);
-    RETURN_NEG(fd)
-    fout = fdopen(fd, "r");
-    if(fout == NULL) return -1;
-  }
-  FILE* ferr = NULL;
-  if(pipe_sources[PROCESS_ERR] >= 0){
-    int fd = open_pipe(pipe_name, "_err", O_RDONLY);
-    RETURN_NEG(fd)
-    ferr = fdopen(fd, "r");
-    if(ferr == NULL) return -1;
+    pipes[i][READ] = pipes[i][WRITE] = -1;
+  int specs[3] = {input, output, error};
+  for(int i=0; i<3; i++){
+    int s = specs[i];
+    if(s == PROCESS_IN || s == PROCESS_OUT || s == PROCESS_ERR){
+      if(pipes[s][READ] < 0 && make_cloexec_pipe(pipes[s]) < 0){
+        close_pipes(pipes);
+        return -1;
+      }
+    }
   }
-  
-  //Read back process id, and set errno if failed
-  long pid = read_long(launcher_out);
-  if(pid < 0){
-    errno = (int)(- pid);
+
+  //Connect the standard streams of the child
+  posix_spawn_file_actions_t actions;
+  int r = posix_spawn_file_actions_init(&actions);
+  if(r == 0 && input == PROCESS_IN)
+    r = posix_spawn_file_actions_adddup2(&actions, pipes[PROCESS_IN][READ], 0);
+  if(r == 0 && (output == PROCESS_OUT || output == PROCESS_ERR))
+    r = posix_spawn_file_actions_adddup2(&actions, pipes[output][WRITE], 1);
+  if(r == 0 && (error == PROCESS_OUT || error == PROCESS_ERR))
+    r = posix_spawn_file_actions_adddup2(&actions, pipes[error][WRITE], 2);
+
+  //Launch child process
+  pid_t pid;
+  if(r == 0)
+    r = posix_spawnp(&pid, file, &actions, NULL, argvs, environ);
+  posix_spawn_file_actions_destroy(&actions);
+  if(r != 0){
+    close_pipes(pipes);
+    errno = r;
     return -1;
-  } 
-  
+  }
+
+  //Close the child ends of the pipes
+  close(pipes[PROCESS_IN][READ]); pipes[PROCESS_IN][READ] = -1;
+  close(pipes[PROCESS_OUT][WRITE]); pipes[PROCESS_OUT][WRITE] = -1;
+  close(pipes[PROCESS_ERR][WRITE]); pipes[PROCESS_ERR][WRITE] = -1;
+
+  //Open streams to child
+  FILE* fin = open_pipe_stream(&pipes[PROCESS_IN][WRITE], "w");
+  FILE* fout = open_pipe_stream(&pipes[PROCESS_OUT][READ], "r");
+  FILE* ferr = open_pipe_stream(&pipes[PROCESS_ERR][READ], "r");
+  if(pipes[PROCESS_IN][WRITE] >= 0 || pipes[PROCESS_OUT][READ] >= 0 || pipes[PROCESS_ERR][READ] >= 0){
+    int code = errno;
+    if(fin != NULL) fclose(fin);
+    if(fout != NULL) fclose(fout);
+    if(ferr != NULL) fclose(ferr);
+    close_pipes(pipes);
+    errno = code;
+    return -1;
+  }
+
   //Return process structure
-  process->pid = pid;
+  process->pid = (long)pid;
+  process->pipes_open = 1;
   process->in = fin;
   process->out = fout;
   process->err = ferr;
   return 0;
 }
 
-void retrieve_process_state (long pid, ProcessState* s, int wait_for_termination){
-  //Check whether launcher has been initialized
-  if(launcher_pid < 0){
-    fprintf(stderr, "Launcher not initialized.\n");
-    exit(-1);
+//Launch n processes. The stream specifiers of process i are
+//stored at streams[3*i] to streams[3*i + 2].
+//Returns the number of processes launched. If this is less than n
+//then errno is set to the reason the next process failed to launch.
+int launch_processes (int n, char** files, char*** argvs, int* streams,
+                      Process** processes){
+  for(int i=0; i<n; i++){
+    int* s = streams + 3*i;
+    if(launch_process(files[i], argvs[i], s[0], s[1], s[2], processes[i]) < 0)
+      return i;
   }
-    
-  //Send command
-  int r = fputc(wait_for_termination? WAIT_COMMAND : STATE_COMMAND, launcher_in);
-  if(r == EOF) exit_with_error();
-  write_long(launcher_in, pid);
-  fflush(launcher_in);
+  return n;
+}
+
+int close_process_pipes (FILE* input, FILE* output, FILE* error){
+  int r = 0;
+  if(input != NULL && fclose(input) == EOF) r = -1;
+  if(output != NULL && fclose(output) == EOF) r = -1;
+  if(error != NULL && fclose(error) == EOF) r = -1;
+  return r;
+}
+
+//------------------------------------------------------------
+//-------------------- Process Queries -----------------------
+//------------------------------------------------------------
 
-  //Read back process state
-  read_process_state(launcher_out, s);
+static int get_process_state (long pid, ProcessState* s, int wait_for_termination){
+  int status;
+  int ret;
+  do ret = waitpid((pid_t)pid, &status, wait_for_termination? 0 : WNOHANG);
+  while(ret < 0 && errno == EINTR);
+
+  if(ret < 0)
+    return -1;
+  else if(ret == 0)
+    *s = (ProcessState){PROCESS_RUNNING, 0};
+  else if(WIFEXITED(status))
+    *s = (ProcessState){PROCESS_DONE, WEXITSTATUS(status)};
+  else if(WIFSIGNALED(status))
+    *s = (ProcessState){PROCESS_TERMINATED, WTERMSIG(status)};
+  else if(WIFSTOPPED(status))
+    *s = (ProcessState){PROCESS_STOPPED, WSTOPSIG(status)};
+  else
+    *s = (ProcessState){PROCESS_RUNNING, 0};
+  return 0;
+}
+
+int retrieve_process_state (long pid, ProcessState* s, int wait_for_termination){
+  return get_process_state(pid, s, wait_for_termination);
+}
+
+//Returns a descriptor that becomes readable when the process
+//terminates, or -1 if the platform does not support it.
+int process_fd (long pid){
+#if defined(PLATFORM_LINUX) && defined(SYS_pidfd_open)
+  return (int)syscall(SYS_pidfd_open, (pid_t)pid, 0);
+#else
+  errno = ENOSYS;
+  return -1;
+#endif
+}
+
+//Block until some child process may have changed state.
+//Waits on process descriptors when they are available, and otherwise
+//on any child without reaping it.
+static int wait_for_child_event (long* pids, int n){
+#if defined(PLATFORM_LINUX) && defined(SYS_pidfd_open)
+  struct pollfd* fds = (struct pollfd*)stz_malloc(n * sizeof(struct pollfd));
+  int nfds = 0;
+  for(; nfds<n; nfds++){
+    fds[nfds].fd = process_fd(pids[nfds]);
+    fds[nfds].events = POLLIN;
+    if(fds[nfds].fd < 0) break;
+  }
+  int r = 0;
+  if(nfds == n){
+    do r = poll(fds, n, -1);
+    while(r < 0 && errno == EINTR);
+  }
+  for(int i=0; i<nfds; i++)
+    close(fds[i].fd);
+  stz_free(fds);
+  if(nfds == n) return r < 0 ? -1 : 0;
+#endif
+
+  //Fall back to waiting on any child.
+  siginfo_t info;
+  info.si_pid = 0;
+  int r2;
+  do r2 = waitid(P_ALL, 0, &info, WEXITED | WNOWAIT);
+  while(r2 < 0 && errno == EINTR);
+  if(r2 < 0) return -1;
+  //If the event belongs to another child then it stays pending,
+  //so back off to avoid spinning on it.
+  for(int i=0; i<n; i++)
+    if(pids[i] == (long)info.si_pid) return 0;
+  usleep(1000);
+  return 0;
+}
+
+//Block until one of the n given processes is no longer running.
+//Stores its state in s and returns its index, or returns -1 on error.
+int wait_any_process (long* pids, int n, ProcessState* s){
+  while(1){
+    for(int i=0; i<n; i++){
+      if(get_process_state(pids[i], s, 0) < 0) return -1;
+      if(s->state != PROCESS_RUNNING) return i;
+    }
+    if(wait_for_child_event(pids, n) < 0) return -1;
+  }
 }
 
 #endif